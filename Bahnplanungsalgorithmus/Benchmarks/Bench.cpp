@@ -0,0 +1,552 @@
+// Benchmark-Suite fuer alle C++-Planer und die Ein-/Ausgabe. Ersetzt das manuelle
+// Eintragen in Vergleich_Algorithmen.xlsx: jede Messung wird als eine JSON-Zeile
+// ausgegeben, so dass zwei Laeufe auf derselben Maschine verglichen werden koennen.
+//
+// Kompilieren (aus dem Ordner Bahnplanungsalgorithmus):
+//   g++ -O2 -std=c++17 -ICpp_Algorithms/include -o Benchmarks/bench Benchmarks/Bench.cpp ParseJson.cpp Map.cpp CostMap.cpp MappedFile.cpp ParseCsv.cpp gridplan/*.cpp
+// Aufruf:
+//   Benchmarks/bench [--repeat N] [--warmup K] [--layout tiled] [--size N ...] [--filter TEXT]
+//                    [--threads 1,2,4,8] [--baseline alt.jsonl] [--output neu.jsonl] [Karten ...]
+// Ohne Kartendateien werden map1.csv bis map9.csv und synthetische Karten (Standard
+// 256 und 1024) gemessen. Mit --baseline wird zu jedem Fall der Median des alten
+// Laufs und der Faktor (speedup > 1 = schneller) ergaenzt.
+//
+// Faelle pro Karte: load_csv, wavefront, astar_manhattan, astar_airplane (jeweils auch
+// mit der Bucket-Queue als *_bucket), jps_manhattan, brushfire, in 8er-Nachbarschaft
+// wavefront_8, astar_airplane_8, astar_octile_8, jps_octile_8 und brushfire_8, mit
+// synthetischen Gelaendekosten (syntheticCosts) dijkstra_terrain (Radix-Heap),
+// dijkstra_terrain_heap, astar_airplane_terrain und astar_airplane_terrain_radix,
+// brushfire_chamfer und brushfire_chamfer_8 (Distanztransformation), brushfire_euclidean und
+// brushfire_euclidean_fixed (exakter euklidischer Abstand), wavefront_threads_T,
+// brushfire_threads_T, chamfer_threads_T und euclidean_threads_T fuer jede Threadzahl T aus --threads
+// (Standard 1, 2, 4 und alle Kerne; T = 1 ist der serielle Kern) mit speedup_vs_serial,
+// brushfire_dynamic_toggle (Hindernis setzen und entfernen im dynamischen Brushfire, mit
+// cells_per_update), dstar_lite_replan (Feld auf dem Pfad sperren und freigeben, je mit
+// Neuplanung durch D* Lite, mit expansions_per_replan), hpa_star und hpa_star_8 (HPA* mit Clustern
+// der Kantenlaenge 16, mit preprocessing_ms und abstract_nodes), hpa_tile_update (Feld sperren und
+// freigeben mit HpaStar::updateTile, mit clusters_per_update), batch_astar und batch_astar_fresh (64 kurze
+// Anfragen wie im Stapelbetrieb mit wiederverwendetem bzw. je Anfrage neu angelegtem Arbeitsspeicher,
+// mit queries_per_second), alt_octile, alt_random, alt_farthest und alt_planar sowie dieselben mit _8 (32
+// zufaellige A*-Anfragen mit octile bzw. 8 Landmarken je Auswahlverfahren, mit preprocessing_ms, table_bytes
+// und expansions_saved gegenueber octile), write_json (Wavefront-Ergebnis) und parse_json (ParseJson auf dieser Datei).
+// Bei Suchen mit Zaehlern kommt ns_per_expansion (Median / expandierte Knoten) dazu, mit
+// --baseline auch baseline_ns_per_expansion bei gleicher Knotenzahl.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../CostMap.h"
+#include "../Map.h"
+#include "../ParseJson.h"
+#include "../gridplan/Batch.h"
+#include "../gridplan/DStarLite.h"
+#include "../gridplan/DynamicBrushfire.h"
+#include "../gridplan/HpaStar.h"
+#include "../gridplan/Options.h"
+#include "../gridplan/Planners.h"
+#include "../gridplan/ResultWriter.h"
+#include "../gridplan/Timing.h"
+
+using namespace std;
+using json = nlohmann::json;
+
+// Zufallskarte mit Rahmen und ca. 20 % Hindernissen, Start oben links, Ziel unten rechts
+void writeSyntheticCsv(const string& filename, int size) {
+    ofstream file(filename);
+    mt19937 rng(42);
+    uniform_int_distribution<int> percent(0, 99);
+    string line;
+    for (int y = 0; y < size; y++) {
+        line.clear();
+        for (int x = 0; x < size; x++) {
+            bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+            char tile = border || percent(rng) < 20 ? '1' : '0';
+            if (x == 1 && y == 1) tile = '2';
+            if (x == size - 2 && y == size - 2) tile = '3';
+            line += tile;
+            line += x + 1 < size ? ',' : '\n';
+        }
+        file << line;
+    }
+}
+
+// Gelaendekosten zur Karte: Grund 1 bis 3, dazu quadratische Flecken mit Kosten bis 20
+CostMap syntheticCosts(const Map& map) {
+    CostMap costs(map.getWidth(), map.getHeight(), map.getLayout());
+    mt19937 rng(7);
+    uniform_int_distribution<int> ground(1, 3);
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            costs.setCost(x, y, ground(rng));
+        }
+    }
+    int patches = map.getWidth() * map.getHeight() / 400 + 1;
+    uniform_int_distribution<int> col(0, map.getWidth() - 1), row(0, map.getHeight() - 1), radius(1, 8), value(4, 20);
+    for (int i = 0; i < patches; i++) {
+        int cx = col(rng), cy = row(rng), r = radius(rng), v = value(rng);
+        for (int y = cy - r; y <= cy + r; y++) {
+            for (int x = cx - r; x <= cx + r; x++) {
+                costs.setCost(x, y, v);
+            }
+        }
+    }
+    return costs;
+}
+
+// Unterdrueckt Konsolenausgaben (z. B. von saveResultsToJson) waehrend einer Messung,
+// damit stdout nur die JSON-Zeilen enthaelt
+class SilenceCout {
+public:
+    SilenceCout() : previous(cout.rdbuf(sink.rdbuf())) {}
+    ~SilenceCout() { cout.rdbuf(previous); }
+
+private:
+    ostringstream sink;
+    streambuf* previous;
+};
+
+// Mediane eines frueheren Laufs, Schluessel "Fall|Karte"
+map<string, double> loadBaseline(const string& filename) {
+    map<string, double> medians;
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cerr << "Baseline konnte nicht geoeffnet werden: " << filename << endl;
+        return medians;
+    }
+    string line;
+    while (getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        json entry = json::parse(line, nullptr, false);
+        if (entry.is_discarded() || !entry.contains("case") || !entry.contains("median_ms")) {
+            continue;
+        }
+        medians[entry["case"].get<string>() + "|" + entry["map"].get<string>()] = entry["median_ms"].get<double>();
+    }
+    return medians;
+}
+
+struct Bench {
+    gridplan::RepeatOptions repeat;
+    string filter;
+    vector<int> threadCounts;
+    map<string, double> baseline;
+    ostream* out = &cout;
+
+    bool selected(const string& name) const {
+        return filter.empty() || name.find(filter) != string::npos;
+    }
+
+    // Eine Ergebniszeile schreiben
+    void report(const string& name, const string& mapName, const Map& map, const gridplan::TimingStats& t,
+        const json& extra = json::object()) {
+        json line = {
+            {"case", name}, {"map", mapName}, {"width", map.getWidth()}, {"height", map.getHeight()},
+            {"runs", t.runs}, {"warmup", t.warmup}, {"min_ms", t.min}, {"median_ms", t.median},
+            {"mean_ms", t.mean}, {"p95_ms", t.p95}, {"stddev_ms", t.stddev}, {"ci95_ms", t.ci95},
+            {"converged", t.converged}
+        };
+        for (auto it = extra.begin(); it != extra.end(); ++it) {
+            line[it.key()] = it.value();
+        }
+        auto old = baseline.find(name + "|" + mapName);
+        if (old != baseline.end() && t.median > 0) {
+            line["baseline_median_ms"] = old->second;
+            line["speedup"] = old->second / t.median;
+            if (extra.contains("expansions") && extra["expansions"].get<long long>() > 0) {
+                line["baseline_ns_per_expansion"] = old->second * 1e6 / extra["expansions"].get<long long>();
+            }
+        }
+        *out << line.dump() << endl;
+    }
+
+    void run(const string& filename, GridLayout layout) {
+        string mapName = filename.substr(filename.find_last_of("/\\") + 1);
+        Map map(0, 0);
+        try {
+            map = Map::loadFromFile(filename, layout);
+        }
+        catch (const exception& e) {
+            cerr << "Fehler beim Einlesen der Karte: " << e.what() << endl;
+            return;
+        }
+
+        if (selected("load_csv")) {
+            gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                Map loaded = Map::loadFromFile(filename, layout);
+            });
+            report("load_csv", mapName, map, t);
+        }
+
+        // Planer: die Wiederholungsmessung von gridplan (frische Arbeitsmatrix je Lauf)
+        auto plan = [&](const string& name, const function<gridplan::PlanResult()>& runPlanner) {
+            if (!selected(name)) {
+                return;
+            }
+            gridplan::PlanResult result = runPlanner();
+            json extra = { {"status_code", result.statusCode}, {"path_length", result.pathLength} };
+            if (result.hasSearchStats) {
+                extra["expansions"] = result.search.expansions;
+                if (result.search.expansions > 0) {
+                    extra["ns_per_expansion"] = result.timing.median * 1e6 / result.search.expansions;
+                }
+            }
+            if (result.clusterSize > 0) {
+                extra["preprocessing_ms"] = result.preprocessingTime;
+                extra["abstract_nodes"] = result.abstractNodes;
+            }
+            report(name, mapName, map, result.timing, extra);
+        };
+        plan("wavefront", [&]() { return gridplan::runWavefront(map, repeat); });
+        plan("astar_manhattan", [&]() { return gridplan::runAStar(map, "manhattan", repeat); });
+        plan("astar_airplane", [&]() { return gridplan::runAStar(map, "airplane", repeat); });
+        gridplan::AStarOptions bucket;
+        bucket.openList = gridplan::OpenListKind::Bucket;
+        gridplan::AStarOptions jps;
+        jps.jumpPoints = true;
+        gridplan::AStarOptions eight;
+        eight.connectivity = 8;
+        gridplan::AStarOptions jpsEight = jps;
+        jpsEight.connectivity = 8;
+        plan("astar_manhattan_bucket", [&]() { return gridplan::runAStar(map, "manhattan", repeat, bucket); });
+        plan("astar_airplane_bucket", [&]() { return gridplan::runAStar(map, "airplane", repeat, bucket); });
+        plan("jps_manhattan", [&]() { return gridplan::runAStar(map, "manhattan", repeat, jps); });
+        plan("brushfire", [&]() { return gridplan::runBrushfire(map, repeat); });
+        plan("wavefront_8", [&]() { return gridplan::runWavefront(map, repeat, false, 8); });
+        plan("astar_airplane_8", [&]() { return gridplan::runAStar(map, "airplane", repeat, eight); });
+        plan("astar_octile_8", [&]() { return gridplan::runAStar(map, "octile", repeat, eight); });
+        plan("jps_octile_8", [&]() { return gridplan::runAStar(map, "octile", repeat, jpsEight); });
+        plan("brushfire_8", [&]() { return gridplan::runBrushfire(map, repeat, 8); });
+        plan("hpa_star", [&]() { return gridplan::runHpaStar(map, repeat); });
+        plan("hpa_star_8", [&]() { return gridplan::runHpaStar(map, repeat, 8); });
+        plan("brushfire_chamfer", [&]() { return gridplan::runBrushfire(map, repeat, 4, 1, gridplan::BrushfireKernel::Chamfer); });
+        plan("brushfire_chamfer_8", [&]() { return gridplan::runBrushfire(map, repeat, 8, 1, gridplan::BrushfireKernel::Chamfer); });
+        plan("brushfire_euclidean", [&]() { return gridplan::runBrushfire(map, repeat, 4, 1, gridplan::BrushfireKernel::Euclidean); });
+        plan("brushfire_euclidean_fixed", [&]() {
+            return gridplan::runBrushfire(map, repeat, 4, 1, gridplan::BrushfireKernel::Euclidean, gridplan::DistanceEncoding::Fixed);
+        });
+        CostMap costs = syntheticCosts(map);
+        gridplan::AStarOptions terrain;
+        terrain.costs = &costs;
+        gridplan::AStarOptions terrainRadix = terrain;
+        terrainRadix.openList = gridplan::OpenListKind::Radix;
+        plan("dijkstra_terrain", [&]() { return gridplan::runDijkstra(map, costs, repeat); });
+        plan("dijkstra_terrain_heap", [&]() { return gridplan::runDijkstra(map, costs, repeat, 4, gridplan::OpenListKind::Heap); });
+        plan("astar_airplane_terrain", [&]() { return gridplan::runAStar(map, "airplane", repeat, terrain); });
+        plan("astar_airplane_terrain_radix", [&]() { return gridplan::runAStar(map, "airplane", repeat, terrainRadix); });
+
+        // Skalierung der ebenensynchronen Breitensuche: Faktor gegenueber einem Thread
+        auto scaling = [&](const string& name, const function<gridplan::PlanResult(int)>& runPlanner) {
+            if (!selected(name)) {
+                return;
+            }
+            double serial = 0;
+            for (int threads : threadCounts) {
+                gridplan::PlanResult result = runPlanner(threads);
+                json extra = { {"status_code", result.statusCode}, {"path_length", result.pathLength}, {"threads", threads} };
+                if (threads == 1) {
+                    serial = result.timing.median;
+                }
+                if (serial > 0 && result.timing.median > 0) {
+                    extra["speedup_vs_serial"] = serial / result.timing.median;
+                }
+                report(name + "_" + to_string(threads), mapName, map, result.timing, extra);
+            }
+        };
+        scaling("wavefront_threads", [&](int threads) { return gridplan::runWavefront(map, repeat, false, 4, threads); });
+        scaling("brushfire_threads", [&](int threads) { return gridplan::runBrushfire(map, repeat, 4, threads); });
+        scaling("chamfer_threads", [&](int threads) {
+            return gridplan::runBrushfire(map, repeat, 4, threads, gridplan::BrushfireKernel::Chamfer);
+        });
+        scaling("euclidean_threads", [&](int threads) {
+            return gridplan::runBrushfire(map, repeat, 4, threads, gridplan::BrushfireKernel::Euclidean);
+        });
+
+        // Dynamischer Brushfire: ein Lauf setzt ein Hindernis auf ein zufaelliges freies Feld
+        // und entfernt es wieder (wie zwei Klicks im Editor)
+        if (selected("brushfire_dynamic_toggle")) {
+            gridplan::DynamicBrushfire dynamic;
+            dynamic.reset(map);
+            mt19937 rng(11);
+            size_t touched = 0, toggles = 0;
+            gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                int x = static_cast<int>(rng() % map.getWidth()), y = static_cast<int>(rng() % map.getHeight());
+                if (map.isObstacle(x, y)) {
+                    return;
+                }
+                touched += dynamic.setObstacle(x, y, true) + dynamic.setObstacle(x, y, false);
+                toggles += 2;
+            });
+            report("brushfire_dynamic_toggle", mapName, map, t,
+                { {"cells_per_update", toggles > 0 ? static_cast<double>(touched) / toggles : 0.0} });
+        }
+
+        // D* Lite: ein Lauf sperrt ein zufaelliges Feld des ersten Pfades, plant neu, gibt das
+        // Feld wieder frei und plant erneut (zwei Neuplanungen wie nach zwei Klicks im Editor)
+        if (selected("dstar_lite_replan") && map.hasStart() && map.hasGoal()) {
+            pair<int, int> start = map.getStarts().front(), goal = map.getGoals().front();
+            gridplan::DStarLite planner(map);
+            gridplan::IncrementalResult first = planner.plan(start.first, start.second, goal.first, goal.second);
+            if (first.path.size() > 2) {
+                mt19937 rng(13);
+                long long expansions = 0, replans = 0;
+                gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                    pair<int, int> cell = first.path[1 + rng() % (first.path.size() - 2)];  // (Zeile, Spalte)
+                    int x = cell.second, y = cell.first;
+                    map.setTile(x, y, 1);
+                    expansions += planner.replan(start.first, start.second, { { x, y } }).expansions;
+                    map.setTile(x, y, 0);
+                    expansions += planner.replan(start.first, start.second, { { x, y } }).expansions;
+                    replans += 2;
+                });
+                report("dstar_lite_replan", mapName, map, t, { {"path_length", first.pathLength},
+                    {"initial_expansions", first.expansions},
+                    {"expansions_per_replan", replans > 0 ? static_cast<double>(expansions) / replans : 0.0} });
+            }
+        }
+
+        // HPA*: ein Lauf sperrt ein zufaelliges freies Feld und gibt es wieder frei, jeweils mit
+        // Neuaufbau der betroffenen Cluster (wie zwei Klicks im Editor)
+        if (selected("hpa_tile_update")) {
+            gridplan::HpaStar hierarchy(map);
+            mt19937 rng(17);
+            long long clusters = 0, updates = 0;
+            gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                int x = static_cast<int>(rng() % map.getWidth()), y = static_cast<int>(rng() % map.getHeight());
+                if (map.getTile(x, y) != 0) {
+                    return;
+                }
+                map.setTile(x, y, 1);
+                clusters += hierarchy.updateTile(x, y);
+                map.setTile(x, y, 0);
+                clusters += hierarchy.updateTile(x, y);
+                updates += 2;
+            });
+            report("hpa_tile_update", mapName, map, t,
+                { {"clusters_per_update", updates > 0 ? static_cast<double>(clusters) / updates : 0.0} });
+        }
+
+        // Stapelbetrieb: viele kurze Anfragen (Ziel hoechstens 32 Felder entfernt), bei denen das
+        // Anlegen der Matrizen fuer die ganze Karte die eigentliche Suche uebersteigt
+        if (selected("batch_astar") || selected("batch_astar_fresh")) {
+            mt19937 rng(19);
+            vector<gridplan::Query> queries;
+            for (int attempt = 0; attempt < 100000 && queries.size() < 64; attempt++) {
+                gridplan::Query q;
+                q.startX = static_cast<int>(rng() % map.getWidth());
+                q.startY = static_cast<int>(rng() % map.getHeight());
+                q.goalX = min(map.getWidth() - 1, max(0, q.startX + static_cast<int>(rng() % 65) - 32));
+                q.goalY = min(map.getHeight() - 1, max(0, q.startY + static_cast<int>(rng() % 65) - 32));
+                if (!map.isObstacle(q.startX, q.startY) && !map.isObstacle(q.goalX, q.goalY)) {
+                    queries.push_back(q);
+                }
+            }
+            Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+            gridplan::SearchWorkspace workspace(map);
+            auto batch = [&](gridplan::SearchWorkspace* reused) {
+                for (const gridplan::Query& q : queries) {
+                    gridplan::aStar(map, q.startX, q.startY, q.goalX, q.goalY, visited, gridplan::HeuristicKind::Manhattan,
+                        nullptr, gridplan::OpenListKind::Heap, 4, nullptr, reused);
+                }
+            };
+            for (bool reuse : { true, false }) {
+                string name = reuse ? "batch_astar" : "batch_astar_fresh";
+                if (!selected(name)) {
+                    continue;
+                }
+                gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() { batch(reuse ? &workspace : nullptr); });
+                report(name, mapName, map, t, { {"queries", queries.size()},
+                    {"queries_per_second", t.median > 0 ? queries.size() * 1000.0 / t.median : 0.0} });
+            }
+        }
+
+        // Landmarken (ALT): dieselben 32 zufaelligen Anfragen mit jedem Auswahlverfahren und mit
+        // octile (bei 4er-Nachbarschaft gleich manhattan) als Vergleich; expansions_saved ist der
+        // Anteil der gegenueber octile eingesparten Expansionen
+        const vector<gridplan::LandmarkSelection> selections = { gridplan::LandmarkSelection::Random,
+            gridplan::LandmarkSelection::Farthest, gridplan::LandmarkSelection::Planar };
+        auto altSelected = [&](const string& suffix) {
+            bool any = selected("alt_octile" + suffix);
+            for (gridplan::LandmarkSelection selection : selections) {
+                any = any || selected(string("alt_") + gridplan::landmarkSelectionName(selection) + suffix);
+            }
+            return any;
+        };
+        if (altSelected("") || altSelected("_8")) {
+            mt19937 rng(23);
+            vector<gridplan::Query> queries;
+            for (int attempt = 0; attempt < 100000 && queries.size() < 32; attempt++) {
+                gridplan::Query q;
+                q.startX = static_cast<int>(rng() % map.getWidth());
+                q.startY = static_cast<int>(rng() % map.getHeight());
+                q.goalX = static_cast<int>(rng() % map.getWidth());
+                q.goalY = static_cast<int>(rng() % map.getHeight());
+                if (!map.isObstacle(q.startX, q.startY) && !map.isObstacle(q.goalX, q.goalY)) {
+                    queries.push_back(q);
+                }
+            }
+            Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+            gridplan::SearchWorkspace workspace(map);
+            auto batch = [&](gridplan::HeuristicKind heuristic, int connectivity, const gridplan::Landmarks* landmarks) {
+                gridplan::SearchStats stats;
+                for (const gridplan::Query& q : queries) {
+                    gridplan::aStar(map, q.startX, q.startY, q.goalX, q.goalY, visited, heuristic, &stats,
+                        gridplan::OpenListKind::Heap, connectivity, nullptr, &workspace, landmarks);
+                }
+                return stats.expansions;
+            };
+            for (int connectivity : { 4, 8 }) {
+                string suffix = connectivity == 8 ? "_8" : "";
+                if (!altSelected(suffix)) {
+                    continue;
+                }
+                long long baseline = batch(gridplan::HeuristicKind::Octile, connectivity, nullptr);
+                if (selected("alt_octile" + suffix)) {
+                    gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                        batch(gridplan::HeuristicKind::Octile, connectivity, nullptr);
+                    });
+                    report("alt_octile" + suffix, mapName, map, t, { {"queries", queries.size()}, {"expansions", baseline} });
+                }
+                for (gridplan::LandmarkSelection selection : selections) {
+                    string name = string("alt_") + gridplan::landmarkSelectionName(selection) + suffix;
+                    if (!selected(name)) {
+                        continue;
+                    }
+                    auto preprocessingStart = chrono::high_resolution_clock::now();
+                    gridplan::Landmarks landmarks(map, 8, selection, connectivity);
+                    auto preprocessingEnd = chrono::high_resolution_clock::now();
+                    long long expansions = batch(gridplan::HeuristicKind::Landmarks, connectivity, &landmarks);
+                    gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                        batch(gridplan::HeuristicKind::Landmarks, connectivity, &landmarks);
+                    });
+                    report(name, mapName, map, t, { {"queries", queries.size()}, {"landmarks", landmarks.getCount()},
+                        {"preprocessing_ms", chrono::duration<double, milli>(preprocessingEnd - preprocessingStart).count()},
+                        {"table_bytes", landmarks.getTableBytes()}, {"expansions", expansions},
+                        {"baseline_expansions", baseline},
+                        {"expansions_saved", baseline > 0 ? 1.0 - static_cast<double>(expansions) / baseline : 0.0} });
+                }
+            }
+        }
+
+        // Ein-/Ausgabe der Ergebnisdateien am Beispiel des Wavefront-Ergebnisses
+        if (!selected("write_json") && !selected("parse_json")) {
+            return;
+        }
+        gridplan::PlanResult result = gridplan::runWavefront(map);
+        if (result.statusCode == 402 || result.statusCode == 403) {
+            result = gridplan::runBrushfire(map);
+        }
+        const string resultFile = "bench_result_" + mapName + ".json";
+        {
+            SilenceCout silence;
+            gridplan::saveResultsToJson(result, resultFile);
+        }
+        if (selected("write_json")) {
+            gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                SilenceCout silence;
+                gridplan::saveResultsToJson(result, resultFile);
+            });
+            report("write_json", mapName, map, t);
+        }
+        if (selected("parse_json")) {
+            gridplan::TimingStats t = gridplan::measureRepeated(repeat, [&]() {
+                ParseJson parsed(resultFile, "Wavefront", "Cpp");
+            });
+            report("parse_json", mapName, map, t);
+        }
+        remove(resultFile.c_str());
+    }
+};
+
+int main(int argc, char* argv[]) {
+    // Gemeinsame Optionen der Planer (--layout, --repeat, --warmup, --precision, --max-repeat)
+    gridplan::PlannerOptions options = gridplan::parsePlannerOptions(argc, argv, 1);
+    Bench bench;
+    bench.repeat = options.repeat;
+    if (!bench.repeat.enabled()) {
+        bench.repeat.repeat = 10;
+        bench.repeat.warmup = 2;
+    }
+
+    vector<string> files;
+    vector<int> sizes;
+    string outputFile;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if ((arg == "--layout" || arg == "--repeat" || arg == "--warmup" || arg == "--precision"
+            || arg == "--max-repeat") && i + 1 < argc) {
+            i++;  // bereits von parsePlannerOptions gelesen
+        }
+        else if (arg == "--size" && i + 1 < argc) {
+            sizes.push_back(stoi(argv[++i]));
+        }
+        else if (arg == "--threads" && i + 1 < argc) {
+            stringstream list(argv[++i]);
+            string item;
+            while (getline(list, item, ',')) {
+                bench.threadCounts.push_back(max(1, stoi(item)));
+            }
+        }
+        else if (arg == "--filter" && i + 1 < argc) {
+            bench.filter = argv[++i];
+        }
+        else if (arg == "--baseline" && i + 1 < argc) {
+            bench.baseline = loadBaseline(argv[++i]);
+        }
+        else if (arg == "--output" && i + 1 < argc) {
+            outputFile = argv[++i];
+        }
+        else {
+            files.push_back(arg);
+        }
+    }
+    if (bench.threadCounts.empty()) {
+        bench.threadCounts = { 1, 2, 4 };
+        int cores = gridplan::resolveThreadCount(0);
+        if (cores > 4) {
+            bench.threadCounts.push_back(cores);
+        }
+    }
+    if (bench.threadCounts.front() != 1) {
+        bench.threadCounts.insert(bench.threadCounts.begin(), 1);  // Bezug fuer speedup_vs_serial
+    }
+    if (files.empty()) {
+        for (int i = 1; i <= 9; i++) {
+            files.push_back("map" + to_string(i) + ".csv");
+        }
+        if (sizes.empty()) {
+            sizes = { 256, 1024 };
+        }
+    }
+
+    ofstream output;
+    if (!outputFile.empty()) {
+        output.open(outputFile);
+        if (!output.is_open()) {
+            cerr << "Fehler beim Oeffnen der Datei zum Schreiben: " << outputFile << endl;
+            return 1;
+        }
+        bench.out = &output;
+    }
+
+    for (const auto& file : files) {
+        bench.run(file, options.layout);
+    }
+    for (int size : sizes) {
+        const string syntheticFile = "bench_synthetic_" + to_string(size) + ".csv";
+        writeSyntheticCsv(syntheticFile, size);
+        bench.run(syntheticFile, options.layout);
+        remove(syntheticFile.c_str());
+    }
+    return 0;
+}
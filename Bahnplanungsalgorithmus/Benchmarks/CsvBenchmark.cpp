@@ -0,0 +1,158 @@
+// Vergleicht den Durchsatz (MB/s) des bisherigen CSV-Loaders (getline + stringstream
+// + stoi) mit dem SIMD-Parser aus ParseCsv.cpp, den Map::loadFromCSV verwendet.
+//
+// Kompilieren (aus dem Ordner Bahnplanungsalgorithmus):
+//   g++ -O2 -std=c++17 -o Benchmarks/CsvBenchmark Benchmarks/CsvBenchmark.cpp Map.cpp MappedFile.cpp ParseCsv.cpp
+// Aufruf:
+//   Benchmarks/CsvBenchmark [--size N] [--runs N] [map9.csv ...]
+// Ohne Kartendateien werden map9.csv und eine synthetische N x N Karte (Standard 4096,
+// ca. 32 MB) gemessen. Die synthetische Karte wird voruebergehend als Datei angelegt.
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Map.h"
+
+using namespace std;
+
+// Bisheriger Loader (Stand vor ParseCsv), als Referenz fuer Laufzeit und Ergebnis
+Map loadLegacy(const string& filename) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        throw runtime_error("Datei konnte nicht geoeffnet werden: " + filename);
+    }
+    vector<vector<int>> tiles;
+    string line;
+    while (getline(file, line)) {
+        vector<int> row;
+        stringstream ss(line);
+        string cell;
+        while (getline(ss, cell, ',')) {
+            row.push_back(stoi(cell));
+        }
+        tiles.push_back(row);
+    }
+    if (tiles.empty()) {
+        throw runtime_error("CSV-Datei ist leer: " + filename);
+    }
+    int height = tiles.size();
+    int width = tiles[0].size();
+    Map map(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            map.setTile(x, y, tiles[y][x]);
+        }
+    }
+    return map;
+}
+
+// Zufallskarte mit Rahmen und ca. 20 % Hindernissen als CSV schreiben
+void writeSyntheticCsv(const string& filename, int size) {
+    ofstream file(filename);
+    mt19937 rng(42);
+    uniform_int_distribution<int> percent(0, 99);
+    string line;
+    for (int y = 0; y < size; y++) {
+        line.clear();
+        for (int x = 0; x < size; x++) {
+            bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+            char tile = border || percent(rng) < 20 ? '1' : '0';
+            if (x == 1 && y == 1) tile = '2';
+            if (x == size - 2 && y == size - 2) tile = '3';
+            line += tile;
+            line += x + 1 < size ? ',' : '\n';
+        }
+        file << line;
+    }
+}
+
+bool sameMap(const Map& a, const Map& b) {
+    if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight()) {
+        return false;
+    }
+    for (int y = 0; y < a.getHeight(); y++) {
+        for (int x = 0; x < a.getWidth(); x++) {
+            if (a.at(x, y) != b.at(x, y) || a.isObstacle(x, y) != b.isObstacle(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Kuerzeste Laufzeit von runs Aufrufen in Sekunden; das letzte Ergebnis landet in out
+template <typename Loader>
+double measure(Loader load, const string& filename, int runs, Map& out) {
+    double best = 1e300;
+    for (int run = 0; run < runs; run++) {
+        auto t0 = chrono::high_resolution_clock::now();
+        Map map = load(filename);
+        auto t1 = chrono::high_resolution_clock::now();
+        best = min(best, chrono::duration<double>(t1 - t0).count());
+        if (run == runs - 1) {
+            out = move(map);
+        }
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int size = 4096;
+    int runs = 0;
+    vector<string> files;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            size = stoi(argv[++i]);
+        }
+        else if (arg == "--runs" && i + 1 < argc) {
+            runs = stoi(argv[++i]);
+        }
+        else {
+            files.push_back(arg);
+        }
+    }
+    const string syntheticFile = "csv_benchmark_synthetic.csv";
+    bool synthetic = files.empty();
+    if (synthetic) {
+        files.push_back("map9.csv");
+        writeSyntheticCsv(syntheticFile, size);
+        files.push_back(syntheticFile);
+    }
+
+    cout << left << setw(32) << "Karte" << right << setw(10) << "MB"
+         << setw(14) << "alt MB/s" << setw(14) << "SIMD MB/s" << setw(10) << "Faktor" << endl;
+
+    bool allEqual = true;
+    for (const auto& file : files) {
+        ifstream probe(file, ios::binary | ios::ate);
+        if (!probe.is_open()) {
+            cerr << "Datei konnte nicht geoeffnet werden: " << file << endl;
+            continue;
+        }
+        double megabytes = static_cast<double>(probe.tellg()) / (1024.0 * 1024.0);
+        // Kleine Dateien oefter wiederholen, damit die Messung ueber dem Timerrauschen liegt
+        int fileRuns = runs > 0 ? runs : (megabytes > 1.0 ? 3 : 200);
+
+        Map legacyMap(0, 0), simdMap(0, 0);
+        double legacy = measure(loadLegacy, file, fileRuns, legacyMap);
+        double simd = measure([](const string& f) { return Map::loadFromCSV(f); }, file, fileRuns, simdMap);
+
+        cout << left << setw(32) << file << right << fixed << setprecision(2) << setw(10) << megabytes
+             << setw(14) << megabytes / legacy << setw(14) << megabytes / simd
+             << setw(9) << legacy / simd << "x" << endl;
+
+        if (!sameMap(legacyMap, simdMap)) {
+            cerr << "Fehler: Ergebnisse unterscheiden sich fuer " << file << endl;
+            allEqual = false;
+        }
+    }
+    if (synthetic) {
+        remove(syntheticFile.c_str());
+    }
+    return allEqual ? 0 : 1;
+}
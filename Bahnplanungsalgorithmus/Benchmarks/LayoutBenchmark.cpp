@@ -0,0 +1,204 @@
+// Vergleicht die Speicheranordnungen RowMajor und Tiled (8x8-Bloecke) fuer die
+// Breitensuchen von Wavefront und Brushfire.
+//
+// Kompilieren (aus dem Ordner Bahnplanungsalgorithmus):
+//   g++ -O2 -std=c++17 -o Benchmarks/LayoutBenchmark Benchmarks/LayoutBenchmark.cpp Map.cpp MappedFile.cpp ParseCsv.cpp
+// Aufruf:
+//   Benchmarks/LayoutBenchmark [--size N] [--runs N] [map9.csv ...]
+// Ohne Kartendateien werden map9.csv und eine synthetische N x N Karte (Standard 8192) gemessen.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Map.h"
+
+using namespace std;
+
+// Bewegungsrichtungen (dx, dy): Oben, Unten, Links, Rechts
+const int directions[4][2] = { {0, -1}, {0, 1}, {-1, 0}, {1, 0} };
+
+// Wavefront ohne Abbruch am Ziel: flutet die gesamte erreichbare Flaeche ab dem Start
+void floodFromStart(const Map& map, int startX, int startY, Grid<int>& distance) {
+    queue<size_t> q;
+    size_t start = map.index(startX, startY);
+    distance.at(start) = 0;
+    q.push(start);
+    while (!q.empty()) {
+        size_t current = q.front();
+        q.pop();
+        int x = map.indexToX(current);
+        int y = map.indexToY(current);
+        unsigned freeMask = map.freeNeighbours(x, y);
+        for (int d = 0; d < 4; d++) {
+            if (!(freeMask & (1u << d))) {
+                continue;
+            }
+            size_t next = map.index(x + directions[d][0], y + directions[d][1]);
+            if (distance.at(next) == -1) {
+                distance.at(next) = distance.at(current) + 1;
+                q.push(next);
+            }
+        }
+    }
+}
+
+// Brushfire: Breitensuche ausgehend von allen Hindernissen
+void floodFromObstacles(const Map& map, Grid<int>& distance) {
+    queue<size_t> q;
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            if (map.isObstacle(x, y)) {
+                size_t i = map.index(x, y);
+                distance.at(i) = 0;
+                q.push(i);
+            }
+        }
+    }
+    while (!q.empty()) {
+        size_t current = q.front();
+        q.pop();
+        int x = map.indexToX(current);
+        int y = map.indexToY(current);
+        unsigned freeMask = map.freeNeighbours(x, y);
+        for (int d = 0; d < 4; d++) {
+            if (!(freeMask & (1u << d))) {
+                continue;
+            }
+            size_t next = map.index(x + directions[d][0], y + directions[d][1]);
+            if (distance.at(next) == -1) {
+                distance.at(next) = distance.at(current) + 1;
+                q.push(next);
+            }
+        }
+    }
+}
+
+// Zufallskarte mit Rahmen, ca. 20 % Hindernissen und Start in der Mitte
+Map makeSyntheticMap(int size, GridLayout layout) {
+    Map map(size, size, layout);
+    mt19937 rng(42);
+    uniform_int_distribution<int> percent(0, 99);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            map.setTile(x, y, percent(rng) < 20 ? 1 : 0);
+        }
+    }
+    map.addFrame();
+    map.setTile(size / 2, size / 2, 2);
+    return map;
+}
+
+// Sucht den Start (2), sonst die erste freie Kachel
+pair<int, int> findStart(const Map& map) {
+    pair<int, int> firstFree(-1, -1);
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            if (map.at(x, y) == 2) {
+                return { x, y };
+            }
+            if (firstFree.first == -1 && map.at(x, y) == 0) {
+                firstFree = { x, y };
+            }
+        }
+    }
+    return firstFree;
+}
+
+bool sameDistances(const Grid<int>& a, const Grid<int>& b) {
+    for (int y = 0; y < a.getHeight(); y++) {
+        for (int x = 0; x < a.getWidth(); x++) {
+            if (a.at(x, y) != b.at(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Misst beide Kernel fuer eine Anordnung; gibt die kuerzeste Laufzeit von runs Durchlaeufen aus
+void measure(const string& name, const Map& map, int runs, Grid<int>& waveOut, Grid<int>& brushOut) {
+    const char* layoutName = map.getLayout() == GridLayout::Tiled ? "tiled8x8" : "row-major";
+    pair<int, int> start = findStart(map);
+
+    double bestWave = 1e300, bestBrush = 1e300;
+    for (int run = 0; run < runs; run++) {
+        Grid<int> distance(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        auto t0 = chrono::high_resolution_clock::now();
+        floodFromStart(map, start.first, start.second, distance);
+        auto t1 = chrono::high_resolution_clock::now();
+        bestWave = min(bestWave, chrono::duration<double, milli>(t1 - t0).count());
+        if (run == runs - 1) {
+            waveOut = move(distance);
+        }
+    }
+    for (int run = 0; run < runs; run++) {
+        Grid<int> distance(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        auto t0 = chrono::high_resolution_clock::now();
+        floodFromObstacles(map, distance);
+        auto t1 = chrono::high_resolution_clock::now();
+        bestBrush = min(bestBrush, chrono::duration<double, milli>(t1 - t0).count());
+        if (run == runs - 1) {
+            brushOut = move(distance);
+        }
+    }
+
+    cout << left << setw(24) << name << setw(12) << layoutName << right << fixed << setprecision(3)
+         << setw(14) << bestWave << setw(14) << bestBrush << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int size = 8192;
+    int runs = 0;
+    vector<string> files;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            size = stoi(argv[++i]);
+        }
+        else if (arg == "--runs" && i + 1 < argc) {
+            runs = stoi(argv[++i]);
+        }
+        else {
+            files.push_back(arg);
+        }
+    }
+    if (files.empty()) {
+        files.push_back("map9.csv");
+        files.push_back("synthetic");
+    }
+
+    cout << left << setw(24) << "Karte" << setw(12) << "Anordnung" << right
+         << setw(14) << "Wavefront ms" << setw(14) << "Brushfire ms" << endl;
+
+    bool allEqual = true;
+    for (const auto& file : files) {
+        bool synthetic = file == "synthetic";
+        string name = synthetic ? "synthetic " + to_string(size) + "x" + to_string(size) : file;
+        // Kleine Karten oefter wiederholen, damit die Messung ueber dem Timerrauschen liegt
+        int fileRuns = runs > 0 ? runs : (synthetic ? 3 : 200);
+
+        Grid<int> waveRow, brushRow, waveTiled, brushTiled;
+        try {
+            Map rowMajor = synthetic ? makeSyntheticMap(size, GridLayout::RowMajor) : Map::loadFromCSV(file, GridLayout::RowMajor);
+            measure(name, rowMajor, fileRuns, waveRow, brushRow);
+        }
+        catch (const exception& e) {
+            cerr << "Fehler beim Laden von " << file << ": " << e.what() << endl;
+            continue;
+        }
+        {
+            Map tiled = synthetic ? makeSyntheticMap(size, GridLayout::Tiled) : Map::loadFromCSV(file, GridLayout::Tiled);
+            measure(name, tiled, fileRuns, waveTiled, brushTiled);
+        }
+
+        if (!sameDistances(waveRow, waveTiled) || !sameDistances(brushRow, brushTiled)) {
+            cerr << "Fehler: Ergebnisse der Anordnungen unterscheiden sich fuer " << name << endl;
+            allEqual = false;
+        }
+    }
+    return allEqual ? 0 : 1;
+}
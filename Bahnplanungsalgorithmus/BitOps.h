@@ -0,0 +1,57 @@
+#ifndef BITOPS_H
+#define BITOPS_H
+
+#include <cstdint>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Index des niedrigsten gesetzten Bits (word darf nicht 0 sein)
+inline int countTrailingZeros(uint64_t word) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#elif defined(_MSC_VER)
+    // 32-Bit-Build: Wort in zwei Haelften aufteilen
+    unsigned long index;
+    if (_BitScanForward(&index, static_cast<unsigned long>(word))) {
+        return static_cast<int>(index);
+    }
+    _BitScanForward(&index, static_cast<unsigned long>(word >> 32));
+    return static_cast<int>(index) + 32;
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+// Anzahl fuehrender Nullbits (word darf nicht 0 sein)
+inline int countLeadingZeros(uint64_t word) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return 63 - static_cast<int>(index);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanReverse(&index, static_cast<unsigned long>(word >> 32))) {
+        return 31 - static_cast<int>(index);
+    }
+    _BitScanReverse(&index, static_cast<unsigned long>(word));
+    return 63 - static_cast<int>(index);
+#else
+    return __builtin_clzll(word);
+#endif
+}
+
+// Anzahl der gesetzten Bits
+inline int popCount(uint64_t word) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(word));
+#elif defined(_MSC_VER)
+    return static_cast<int>(__popcnt(static_cast<unsigned int>(word)) + __popcnt(static_cast<unsigned int>(word >> 32)));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+#endif
@@ -0,0 +1,138 @@
+#include "CostMap.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include "MappedFile.h"
+#include "ParseCsv.h"
+
+namespace {
+    const char COST_MAGIC[4] = { 'B', 'C', 'S', 'T' };
+    const uint16_t COST_VERSION = 1;
+    const uint64_t COST_ALIGNMENT = 64;
+
+    bool endsWith(const string& text, const string& suffix) {
+        return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    void validateHeader(const BinaryCostHeader& header, uint64_t fileSize, const string& filename) {
+        if (memcmp(header.magic, COST_MAGIC, sizeof(COST_MAGIC)) != 0) {
+            throw runtime_error("Keine binaere Kostendatei: " + filename);
+        }
+        if (header.version != COST_VERSION) {
+            throw runtime_error("Nicht unterstuetzte Version der Kostendatei: " + filename);
+        }
+        if (header.encoding > 1 || header.width == 0 || header.height == 0
+            || header.width > INT32_MAX - 256 || header.height > INT32_MAX - 2
+            || header.minCost == 0 || header.minCost > header.maxCost) {
+            throw runtime_error("Ungueltiger Kopf der Kostendatei: " + filename);
+        }
+        GridLayout layout = header.encoding == 1 ? GridLayout::Tiled : GridLayout::RowMajor;
+        uint64_t costBytes = Grid<CostMap::Cost>::storageSize(header.width, header.height, layout);
+        if (header.costOffset % COST_ALIGNMENT != 0 || header.costOffset < sizeof(BinaryCostHeader)
+            || header.costOffset + costBytes > fileSize) {
+            throw runtime_error("Kostendatei ist abgeschnitten oder beschaedigt: " + filename);
+        }
+    }
+}
+
+CostMap::CostMap(int width, int height, GridLayout layout)
+    : width(width), height(height), costs(width, height, 1, layout) {}
+
+CostMap::CostMap(Grid<Cost> costs, int minCost, int maxCost)
+    : width(costs.getWidth()), height(costs.getHeight()), costs(std::move(costs)), minCost(minCost), maxCost(maxCost) {}
+
+void CostMap::setCost(int x, int y, int value) {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return;
+    }
+    value = std::min(255, std::max(1, value));
+    costs.at(x, y) = static_cast<Cost>(value);
+    minCost = std::min(minCost, value);
+    maxCost = std::max(maxCost, value);
+}
+
+bool CostMap::matches(const Map& map) const {
+    return width == map.getWidth() && height == map.getHeight() && getLayout() == map.getLayout();
+}
+
+CostMap CostMap::withLayout(GridLayout layout) const {
+    Grid<Cost> converted(width, height, 1, layout);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            converted.at(x, y) = costs.at(x, y);
+        }
+    }
+    return CostMap(std::move(converted), minCost, maxCost);
+}
+
+CostMap CostMap::loadFromCSV(const string& filename, GridLayout layout) {
+    CsvMap csv = parseCsvFile(filename);
+    int low = 255, high = 1;
+    for (Cost& cost : csv.cells) {
+        if (cost == 0) {
+            cost = 1; // 0 = Standardkosten
+        }
+        low = std::min(low, static_cast<int>(cost));
+        high = std::max(high, static_cast<int>(cost));
+    }
+    if (csv.cells.empty()) {
+        low = 1;
+    }
+    CostMap loaded(Grid<Cost>(csv.width, csv.height, std::move(csv.cells)), low, high);
+    return layout == GridLayout::RowMajor ? loaded : loaded.withLayout(layout);
+}
+
+CostMap CostMap::loadFromBinary(const string& filename, bool verifyChecksum) {
+    auto file = std::make_shared<MappedFile>(filename);
+    if (file->size() < sizeof(BinaryCostHeader)) {
+        throw runtime_error("Kostendatei ist zu kurz: " + filename);
+    }
+    BinaryCostHeader header;
+    memcpy(&header, file->data(), sizeof(header));
+    validateHeader(header, file->size(), filename);
+
+    int width = static_cast<int>(header.width);
+    int height = static_cast<int>(header.height);
+    GridLayout layout = header.encoding == 1 ? GridLayout::Tiled : GridLayout::RowMajor;
+    Cost* costData = file->data() + header.costOffset;
+    if (verifyChecksum && Map::checksum(costData, Grid<Cost>::storageSize(width, height, layout)) != header.checksum) {
+        throw runtime_error("Pruefsumme der Kostendatei stimmt nicht: " + filename);
+    }
+    // Das Raster verweist direkt in die eingeblendete Datei und haelt sie am Leben
+    return CostMap(Grid<Cost>(width, height, layout, costData, file), header.minCost, header.maxCost);
+}
+
+void CostMap::saveToBinary(const string& filename) const {
+    BinaryCostHeader header = {};
+    memcpy(header.magic, COST_MAGIC, sizeof(COST_MAGIC));
+    header.version = COST_VERSION;
+    header.encoding = getLayout() == GridLayout::Tiled ? 1 : 0;
+    header.minCost = static_cast<uint8_t>(minCost);
+    header.maxCost = static_cast<uint8_t>(maxCost);
+    header.width = static_cast<uint32_t>(width);
+    header.height = static_cast<uint32_t>(height);
+    uint64_t costBytes = costs.size();
+    header.costOffset = COST_ALIGNMENT;
+    header.checksum = Map::checksum(costs.data(), costBytes);
+
+    ofstream file(filename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        throw runtime_error("Datei konnte nicht geoeffnet werden: " + filename);
+    }
+    const char zeros[COST_ALIGNMENT] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(zeros, header.costOffset - sizeof(header));
+    file.write(reinterpret_cast<const char*>(costs.data()), costBytes);
+    if (!file) {
+        throw runtime_error("Fehler beim Schreiben der Kostendatei: " + filename);
+    }
+}
+
+CostMap CostMap::loadFromFile(const string& filename, GridLayout layout) {
+    if (endsWith(filename, ".bcost")) {
+        return loadFromBinary(filename);
+    }
+    return loadFromCSV(filename, layout);
+}
@@ -0,0 +1,73 @@
+#ifndef COSTMAP_H
+#define COSTMAP_H
+#include <cstdint>
+#include <string>
+#include "Grid.h"
+#include "Map.h"
+using namespace std;
+
+// Kopf einer binaeren Kostendatei (*.bcost), 64 Byte, little-endian. Danach folgen,
+// auf 64 Byte ausgerichtet, die Kosten (1 Byte pro Kachel in der Speicheranordnung
+// aus encoding). Der Abschnitt wird beim Laden per mmap direkt verwendet.
+struct BinaryCostHeader {
+    char magic[4];              // "BCST"
+    uint16_t version;           // derzeit 1
+    uint8_t encoding;           // 0 = RowMajor, 1 = Tiled (8x8-Bloecke)
+    uint8_t minCost;            // kleinste Kosten der Datei
+    uint32_t width, height;
+    uint8_t maxCost;            // groesste Kosten der Datei
+    uint8_t reserved[7];
+    uint64_t costOffset;        // Byte-Offset der Kosten ab Dateianfang
+    uint64_t checksum;          // FNV-1a (64 Bit) ueber die Kostenbytes
+    uint8_t padding[24];
+};
+static_assert(sizeof(BinaryCostHeader) == 64, "BinaryCostHeader muss 64 Byte gross sein");
+
+// Gelaendekosten pro Kachel, getrennt von der Belegungskarte (Map). Jede Kachel kostet
+// beim Betreten 1 bis 255 Einheiten (1 Byte, damit das Raster so klein wie die Karte
+// bleibt); ein Zug kostet Schrittkosten der Nachbarschaft mal Kosten des Zielfeldes.
+// Hindernisse kommen weiterhin aus der Karte. In CSV-Dateien wird 0 als 1 gelesen,
+// so dass eine Kostendatei nur die langsamen Bereiche enthalten muss.
+class CostMap {
+public:
+    using Cost = uint8_t;
+
+    // Alle Kacheln mit Kosten 1
+    CostMap(int width = 0, int height = 0, GridLayout layout = GridLayout::RowMajor);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    GridLayout getLayout() const { return costs.getLayout(); }
+
+    // Zugriff ueber dieselben linearen Indizes wie Map::index bei gleicher Anordnung
+    Cost at(size_t i) const { return costs.at(i); }
+    Cost at(int x, int y) const { return costs.at(x, y); }
+    const Cost* data() const { return costs.data(); }
+    void setCost(int x, int y, int value);
+
+    // Untere bzw. obere Schranke der Kosten; die untere skaliert die Heuristik von A*.
+    // setCost senkt die Schranken nur, sie bleiben also gueltig.
+    int getMinCost() const { return minCost; }
+    int getMaxCost() const { return maxCost; }
+
+    // Passt die Kostenkarte zur Karte (gleiche Groesse und Speicheranordnung)?
+    bool matches(const Map& map) const;
+    // Kopie in anderer Speicheranordnung
+    CostMap withLayout(GridLayout layout) const;
+
+    static CostMap loadFromCSV(const string& filename, GridLayout layout = GridLayout::RowMajor);
+    static CostMap loadFromBinary(const string& filename, bool verifyChecksum = false);
+    void saveToBinary(const string& filename) const;
+    // Laedt *.bcost binaer, alles andere als CSV
+    static CostMap loadFromFile(const string& filename, GridLayout layout = GridLayout::RowMajor);
+
+private:
+    CostMap(Grid<Cost> costs, int minCost, int maxCost);
+
+    int width, height;
+    Grid<Cost> costs;
+    int minCost = 1;
+    int maxCost = 1;
+};
+
+#endif
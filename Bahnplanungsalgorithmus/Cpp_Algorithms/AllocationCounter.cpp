@@ -0,0 +1,43 @@
+#include <cstdlib>
+#include <new>
+#include "../gridplan/MemoryProbe.h"
+
+// Ersetzter globaler operator new fuer die Planer-Programme (Wavefront, A_Star, Brushfire,
+// HPA_Star): jede Anforderung wird ueber gridplan::countAllocation gezaehlt, so dass
+// MemoryProbe memory_allocated liefern kann. Bewusst nicht Teil der Bibliothek gridplan,
+// damit Editor, Bench und MapConverter ohne Zaehler pro Anforderung auskommen; dort ist
+// allocatedBytes() immer 0. Wird direkt mit dem Programm kompiliert, nicht ueber ein Archiv.
+
+static void* countedAllocate(std::size_t size) {
+    gridplan::countAllocation(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(std::size_t size) {
+    void* p = countedAllocate(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <string>
+#include "../gridplan/Batch.h"
+#include "../gridplan/Options.h"
+#include "../gridplan/Planners.h"
+#include "../gridplan/ResultWriter.h"
+
+using namespace std;
+
+// HPA*-Programm: duenne Huelle um gridplan::runHpaStar
+// Aufruf: HPA_Star <Karte> <JSON-Datei> [--layout tiled] [--connectivity 4|8] [--cluster-size N] [--repeat N --warmup K]
+//         [--queries <Datei>|-]
+// Die Karte wird in Cluster von N x N Kacheln (Standard 16) zerlegt; die Zeit fuer den Aufbau der
+// Abstraktion steht getrennt als preprocessing_time in der JSON. Der Pfad ist nicht immer optimal.
+// --queries plant alle Anfragen der Datei im Stapelbetrieb auf einer einmal aufgebauten Abstraktion.
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        cerr << "Fehler: Zu wenige Argumente!" << endl;
+        return 1;
+    }
+
+    string input_map = argv[1];
+    string result_name = argv[2];
+    gridplan::PlannerOptions options = gridplan::parsePlannerOptions(argc, argv, 3);
+
+    Map map(0, 0);
+    if (!gridplan::loadMap(input_map, options, map)) {
+        return 500;
+    }
+
+    if (!options.queriesFile.empty()) {
+        gridplan::HpaStar hierarchy(map, options.clusterSize, options.connectivity);
+        gridplan::BatchSummary summary;
+        if (!gridplan::runBatchFiles(map, options.queriesFile, result_name, gridplan::hpaStarPlanner(hierarchy), summary)) {
+            return 500;
+        }
+        cerr << summary.queries << " Anfragen in " << summary.totalTime << " ms" << endl;
+        return 0;
+    }
+
+    gridplan::PlanResult result = gridplan::runHpaStar(map, options.repeat, options.connectivity, options.clusterSize);
+    if (result.statusCode == 402) {
+        cout << "Start nicht gefunden!" << endl;
+        return 402;
+    }
+    if (result.statusCode == 403) {
+        cout << "Ziel nicht gefunden!" << endl;
+        return 403;
+    }
+
+    cout << "HPA*-Algorithmus abgeschlossen." << endl;
+    cout << "Vorberechnung: " << result.preprocessingTime << " ms (" << result.abstractNodes << " Knoten)" << endl;
+    cout << "Berechnungszeit: " << result.computingTime << " ms" << endl;
+    cout << "Expandierte Knoten: " << result.search.expansions << endl;
+
+    gridplan::saveResultsToJson(result, result_name);
+
+    return 0;
+}
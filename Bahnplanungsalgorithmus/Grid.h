@@ -0,0 +1,161 @@
+#ifndef GRID_H
+#define GRID_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Speicheranordnung eines Rasters:
+// RowMajor: klassisch zeilenweise.
+// Tiled:    Bloecke aus 8x8 Zellen liegen hintereinander (innerhalb eines Blocks
+//           zeilenweise). Vertikale Nachbarn liegen meist im selben 64er-Block,
+//           was Breitensuchen auf grossen Karten cachefreundlicher macht.
+enum class GridLayout { RowMajor, Tiled };
+
+// Zweidimensionales Raster in einem einzigen, zusammenhaengenden Puffer.
+// Wird von Map fuer die Kacheln und von den Algorithmen fuer ihre
+// Arbeitsmatrizen (visited, distance, gScore, ...) verwendet.
+//
+// Der Puffer gehoert entweder dem Raster selbst oder liegt in fremdem Speicher
+// (z. B. einer per mmap eingeblendeten Kartendatei), dessen Lebensdauer ueber
+// owner gesichert wird. Kopien legen immer einen eigenen Puffer an.
+template <typename T>
+class Grid {
+public:
+    static constexpr int TILE_SHIFT = 3;                // 8x8 Bloecke
+    static constexpr int TILE_SIZE = 1 << TILE_SHIFT;
+
+    Grid(int width = 0, int height = 0, const T& value = T(), GridLayout layout = GridLayout::RowMajor)
+        : width(width), height(height), layout(layout),
+          tilesPerRow((width + TILE_SIZE - 1) >> TILE_SHIFT),
+          count(storageSize(width, height, layout)),
+          storage(count, value), cells(storage.data()) {
+    }
+
+    // Zeilenweises Raster, das einen fertig befuellten Puffer (width * height Elemente) uebernimmt
+    Grid(int width, int height, std::vector<T>&& cells)
+        : width(width), height(height), layout(GridLayout::RowMajor),
+          tilesPerRow((width + TILE_SIZE - 1) >> TILE_SHIFT),
+          count(storageSize(width, height, GridLayout::RowMajor)),
+          storage(std::move(cells)), cells(storage.data()) {
+    }
+
+    // Raster ueber fremdem Speicher mit storageSize(width, height, layout) Elementen
+    Grid(int width, int height, GridLayout layout, T* external, std::shared_ptr<void> owner)
+        : width(width), height(height), layout(layout),
+          tilesPerRow((width + TILE_SIZE - 1) >> TILE_SHIFT),
+          count(storageSize(width, height, layout)),
+          owner(std::move(owner)), cells(external) {
+    }
+
+    Grid(const Grid& other)
+        : width(other.width), height(other.height), layout(other.layout), tilesPerRow(other.tilesPerRow),
+          count(other.count), storage(other.cells, other.cells + other.count), cells(storage.data()) {
+    }
+
+    Grid(Grid&& other) noexcept
+        : width(other.width), height(other.height), layout(other.layout), tilesPerRow(other.tilesPerRow),
+          count(other.count), storage(std::move(other.storage)), owner(std::move(other.owner)),
+          cells(owner ? other.cells : storage.data()) {
+        other.cells = nullptr;
+        other.count = 0;
+    }
+
+    Grid& operator=(Grid other) noexcept {
+        width = other.width;
+        height = other.height;
+        layout = other.layout;
+        tilesPerRow = other.tilesPerRow;
+        count = other.count;
+        storage = std::move(other.storage);
+        owner = std::move(other.owner);
+        cells = owner ? other.cells : storage.data();
+        return *this;
+    }
+
+    // true, wenn der Puffer in fremdem Speicher liegt (z. B. eingeblendete Datei)
+    bool isExternal() const { return owner != nullptr; }
+
+    // Benoetigte Anzahl Elemente fuer ein Raster (bei Tiled inklusive Auffuellung)
+    static size_t storageSize(int width, int height, GridLayout layout) {
+        if (layout == GridLayout::RowMajor) {
+            return static_cast<size_t>(width) * height;
+        }
+        size_t paddedWidth = static_cast<size_t>((width + TILE_SIZE - 1) >> TILE_SHIFT) << TILE_SHIFT;
+        size_t paddedHeight = static_cast<size_t>((height + TILE_SIZE - 1) >> TILE_SHIFT) << TILE_SHIFT;
+        return paddedWidth * paddedHeight;
+    }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    GridLayout getLayout() const { return layout; }
+    bool isRowMajor() const { return layout == GridLayout::RowMajor; }
+
+    // Anzahl der gespeicherten Zellen (bei Tiled inklusive Auffuellung auf volle Bloecke)
+    size_t size() const { return count; }
+
+    bool contains(int x, int y) const {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    // Linearer Index einer Zelle und Rueckrechnung in Koordinaten
+    size_t index(int x, int y) const {
+        if (layout == GridLayout::RowMajor) {
+            return static_cast<size_t>(y) * width + x;
+        }
+        size_t tile = static_cast<size_t>(y >> TILE_SHIFT) * tilesPerRow + (x >> TILE_SHIFT);
+        return (tile << (2 * TILE_SHIFT)) | ((y & (TILE_SIZE - 1)) << TILE_SHIFT) | (x & (TILE_SIZE - 1));
+    }
+    int indexToX(size_t i) const {
+        if (layout == GridLayout::RowMajor) {
+            return static_cast<int>(i % width);
+        }
+        size_t tile = i >> (2 * TILE_SHIFT);
+        return static_cast<int>((tile % tilesPerRow) << TILE_SHIFT) + static_cast<int>(i & (TILE_SIZE - 1));
+    }
+    int indexToY(size_t i) const {
+        if (layout == GridLayout::RowMajor) {
+            return static_cast<int>(i / width);
+        }
+        size_t tile = i >> (2 * TILE_SHIFT);
+        return static_cast<int>((tile / tilesPerRow) << TILE_SHIFT) + static_cast<int>((i >> TILE_SHIFT) & (TILE_SIZE - 1));
+    }
+
+    // Zugriff ohne Bereichspruefung
+    T& at(int x, int y) { return cells[index(x, y)]; }
+    const T& at(int x, int y) const { return cells[index(x, y)]; }
+    T& at(size_t i) { return cells[i]; }
+    const T& at(size_t i) const { return cells[i]; }
+
+    // Rohzeiger auf eine Zeile (getWidth() Elemente), nur bei RowMajor gueltig
+    T* row(int y) { return cells + static_cast<size_t>(y) * width; }
+    const T* row(int y) const { return cells + static_cast<size_t>(y) * width; }
+    T* data() { return cells; }
+    const T* data() const { return cells; }
+
+    // Kopiert eine Zeile unabhaengig von der Speicheranordnung nach out
+    void copyRow(int y, T* out) const {
+        if (layout == GridLayout::RowMajor) {
+            std::copy(row(y), row(y) + width, out);
+            return;
+        }
+        for (int x = 0; x < width; x += TILE_SIZE) {
+            const T* src = cells + index(x, y);
+            std::copy(src, src + std::min(TILE_SIZE, width - x), out + x);
+        }
+    }
+
+    void fill(const T& value) { std::fill(cells, cells + count, value); }
+
+private:
+    int width, height;
+    GridLayout layout;
+    int tilesPerRow;
+    size_t count;
+    std::vector<T> storage;         // eigener Puffer (leer bei fremdem Speicher)
+    std::shared_ptr<void> owner;    // haelt fremden Speicher am Leben
+    T* cells;
+};
+
+#endif
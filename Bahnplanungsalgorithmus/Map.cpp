@@ -1,34 +1,194 @@
-#include <SFML/Graphics.hpp>
 #include "Map.h"
+#include <cstring>
+#include <memory>
+#include "BitOps.h"
+#include "MappedFile.h"
+#include "ParseCsv.h"
 
-Map::Map(int width, int height)
-    : width(width), height(height), tiles(height, std::vector<int>(width, 0)) {
+Map::Map(int width, int height, GridLayout layout)
+    : width(width), height(height), tiles(width, height, 0, layout),
+      obstacleWords(obstacleWordsFor(width)),
+      obstacles(obstacleWords, height + 2, 0) {
+    initObstacleBorder();
+}
+
+// Rand der Bitmap (und die Auffuellbits am Zeilenende) als Hindernis markieren
+void Map::initObstacleBorder() {
+    for (int y = -1; y <= height; ++y) {
+        uint64_t* bits = obstacles.row(y + 1);
+        for (int bit = 0; bit < obstacleWords * 64; ++bit) {
+            if (y == -1 || y == height || bit == 0 || bit > width) {
+                bits[bit >> 6] |= uint64_t(1) << (bit & 63);
+            }
+        }
+    }
+}
+
+Map::Map(Grid<Tile> tiles, Grid<uint64_t> obstacles, TileIndex tileIndex)
+    : width(tiles.getWidth()), height(tiles.getHeight()), tiles(std::move(tiles)),
+      obstacleWords(obstacles.getWidth()), obstacles(std::move(obstacles)), tileIndex(std::move(tileIndex)) {
+}
+
+void Map::TileIndex::addRow(int y, const Tile* row, int width, uint64_t* bits, int words) {
+    std::fill(bits, bits + words, 0);
+    for (int x = 0; x < width; ++x) {
+        Tile tile = row[x];
+        size_t bit = static_cast<size_t>(x) + 1;
+        bits[bit >> 6] |= static_cast<uint64_t>(tile == 1) << (bit & 63);
+        if (tile >= 2) {
+            if (tile == 2) {
+                starts.emplace_back(x, y);
+            }
+            else if (tile == 3) {
+                goals.emplace_back(x, y);
+            }
+        }
+    }
+    addStats(y, bits, words, width);
+    // Auffuellbits: linker Rand (Bit 0) und alles rechts der letzten Spalte
+    bits[0] |= 1;
+    for (int bit = width + 1; bit < words * 64; ++bit) {
+        bits[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+}
+
+// Zaehlt die Hindernisse einer Bitmap-Zeile und erweitert das Rechteck; die
+// Auffuellbits (Bit 0 und Bits rechts von Spalte width - 1) werden ausgeblendet
+void Map::TileIndex::addStats(int y, const uint64_t* bits, int words, int width) {
+    int lastBit = width;                // Bit der letzten Spalte
+    for (int w = 0; w < words && w * 64 <= lastBit; ++w) {
+        uint64_t word = bits[w];
+        if (w == 0) {
+            word &= ~uint64_t(1);
+        }
+        if (lastBit - w * 64 < 63) {
+            word &= (uint64_t(1) << (lastBit - w * 64 + 1)) - 1;
+        }
+        if (word == 0) {
+            continue;
+        }
+        obstacleCount += popCount(word);
+        int first = w * 64 + countTrailingZeros(word) - 1;
+        int last = w * 64 + 63 - countLeadingZeros(word) - 1;
+        if (bounds.empty()) {
+            bounds = { first, y, last, y };
+        }
+        else {
+            bounds.minX = std::min(bounds.minX, first);
+            bounds.maxX = std::max(bounds.maxX, last);
+            bounds.minY = std::min(bounds.minY, y);
+            bounds.maxY = std::max(bounds.maxY, y);
+        }
+    }
+}
+
+pair<int, int> Map::lastInScanOrder(const vector<pair<int, int>>& positions) {
+    pair<int, int> last(-1, -1);
+    for (const auto& p : positions) {
+        if (last.first == -1 || p.second > last.second || (p.second == last.second && p.first > last.first)) {
+            last = p;
+        }
+    }
+    return last;
+}
+
+size_t Map::getObstacleCount() const {
+    if (tileIndex.statsDirty) {
+        recomputeStats();
+    }
+    return tileIndex.obstacleCount;
+}
+
+ObstacleBounds Map::getObstacleBounds() const {
+    if (tileIndex.statsDirty) {
+        recomputeStats();
+    }
+    return tileIndex.bounds;
+}
+
+// Zaehler und Rechteck aus der Bitmap neu aufbauen (1 Bit pro Kachel, per popcount)
+void Map::recomputeStats() const {
+    tileIndex.obstacleCount = 0;
+    tileIndex.bounds = { 0, 0, -1, -1 };
+    for (int y = 0; y < height; ++y) {
+        tileIndex.addStats(y, obstacleRow(y), obstacleWords, width);
+    }
+    tileIndex.statsDirty = false;
+}
+
+void Map::updateIndex(int x, int y, Tile oldValue, Tile newValue) {
+    if (oldValue == 2 || oldValue == 3) {
+        vector<pair<int, int>>& positions = oldValue == 2 ? tileIndex.starts : tileIndex.goals;
+        for (size_t i = 0; i < positions.size(); ++i) {
+            if (positions[i].first == x && positions[i].second == y) {
+                positions.erase(positions.begin() + i);
+                break;
+            }
+        }
+    }
+    if (newValue == 2) {
+        tileIndex.starts.emplace_back(x, y);
+    }
+    else if (newValue == 3) {
+        tileIndex.goals.emplace_back(x, y);
+    }
 
+    if (tileIndex.statsDirty) {
+        return;
+    }
+    if (oldValue == 1) {
+        --tileIndex.obstacleCount;
+        // Lag das Hindernis auf dem Rand des Rechtecks, kann es schrumpfen: spaeter neu berechnen
+        const ObstacleBounds& b = tileIndex.bounds;
+        if (x == b.minX || x == b.maxX || y == b.minY || y == b.maxY) {
+            tileIndex.statsDirty = true;
+        }
+    }
+    else if (newValue == 1) {
+        ++tileIndex.obstacleCount;
+        ObstacleBounds& b = tileIndex.bounds;
+        b = b.empty() ? ObstacleBounds{ x, y, x, y }
+                      : ObstacleBounds{ std::min(b.minX, x), std::min(b.minY, y), std::max(b.maxX, x), std::max(b.maxY, y) };
+    }
+}
+
+void Map::setObstacleBit(int x, int y, bool obstacle) {
+    size_t bit = static_cast<size_t>(x) + 1;
+    uint64_t& word = obstacles.row(y + 1)[bit >> 6];
+    uint64_t mask = uint64_t(1) << (bit & 63);
+    word = obstacle ? (word | mask) : (word & ~mask);
 }
 
 void Map::addFrame() {
-    // Fge einen Rahmen aus 1en hinzu
+    // Füge einen Rahmen aus 1en hinzu
     for (int i = 0; i < height; ++i) {
-        tiles[i][0] = 1;                 // Linker Rand
-        tiles[i][width - 1] = 1;         // Rechter Rand
+        setTile(0, i, 1);                // Linker Rand
+        setTile(width - 1, i, 1);        // Rechter Rand
     }
     for (int j = 0; j < width; ++j) {
-        tiles[0][j] = 1;                 // Oberer Rand
-        tiles[height - 1][j] = 1;        // Unterer Rand
+        setTile(j, 0, 1);                // Oberer Rand
+        setTile(j, height - 1, 1);       // Unterer Rand
     }
 }
 
 void Map::setTile(int x, int y, int value) {
     if (x >= 0 && x < width && y >= 0 && y < height) {
-        tiles[y][x] = value;
+        Tile oldValue = tiles.at(x, y);
+        Tile newValue = static_cast<Tile>(value);
+        if (oldValue == newValue) {
+            return;
+        }
+        tiles.at(x, y) = newValue;
+        setObstacleBit(x, y, newValue == 1);
+        updateIndex(x, y, oldValue, newValue);
     }
 }
 
 int Map::getTile(int x, int y) const {
     if (x >= 0 && x < width && y >= 0 && y < height) {
-        return tiles[y][x];
+        return tiles.at(x, y);
     }
-    return -1; // Ungltige Position
+    return -1; // Ungültige Position
 }
 
 int Map::getWidth() const {
@@ -40,46 +200,236 @@ int Map::getHeight() const {
 }
 
 
-Map Map::loadFromCSV(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
-        throw runtime_error("Datei konnte nicht geffnet werden: " + filename);
+Map Map::loadFromCSV(const string& filename, GridLayout layout) {
+    // Ein Durchlauf: jede Zeile wird direkt nach dem Parsen, solange sie noch im
+    // Cache liegt, in Hindernis-Bitmap und Index (Start, Ziel, Statistik) eingetragen
+    TileIndex tileIndex;
+    vector<uint64_t> bits;
+    int words = 0;
+    CsvMap csv = parseCsvFile(filename, [&](int y, const Tile* row, int rowWidth) {
+        if (y == 0) {
+            words = obstacleWordsFor(rowWidth);
+            bits.assign(words, ~uint64_t(0));               // oberer Rand
+        }
+        size_t offset = bits.size();
+        bits.resize(offset + words);
+        tileIndex.addRow(y, row, rowWidth, bits.data() + offset, words);
+    });
+    bits.insert(bits.end(), words, ~uint64_t(0));           // unterer Rand
+    Grid<uint64_t> obstacles(words, csv.height + 2, std::move(bits));
+
+    if (layout == GridLayout::RowMajor) {
+        // Der zeilenweise Puffer wird ohne Kopie uebernommen
+        return Map(Grid<Tile>(csv.width, csv.height, std::move(csv.cells)), std::move(obstacles), std::move(tileIndex));
     }
+    Grid<Tile> tiles(csv.width, csv.height, 0, layout);
+    for (int y = 0; y < csv.height; ++y) {
+        const Tile* row = csv.cells.data() + static_cast<size_t>(y) * csv.width;
+        for (int x = 0; x < csv.width; ++x) {
+            tiles.at(x, y) = row[x];
+        }
+    }
+    return Map(std::move(tiles), std::move(obstacles), std::move(tileIndex));
+}
 
-    vector<std::vector<int>> tiles;
-    string line;
+namespace {
+    const char BINARY_MAGIC[4] = { 'B', 'M', 'A', 'P' };
+    const uint16_t BINARY_VERSION = 2;     // 2: Pruefsumme auch ueber die Hindernis-Bitmap
+    const uint64_t BINARY_ALIGNMENT = 64;
 
-    // Lies Zeile fr Zeile
-    while (std::getline(file, line)) {
-        vector<int> row;
-        stringstream ss(line);
-        string cell;
+    uint64_t alignUp(uint64_t offset) {
+        return (offset + BINARY_ALIGNMENT - 1) & ~(BINARY_ALIGNMENT - 1);
+    }
+
+    bool endsWith(const string& text, const string& suffix) {
+        return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
 
-        // Teile die Zeile in Zellen (getrennt durch Kommata)
-        while (getline(ss, cell, ',')) {
-            row.push_back(stoi(cell)); // Konvertiere jede Zelle in einen Integer
+    // Prueft den Kopf und die Lage der Abschnitte gegen die Dateigroesse
+    void validateHeader(const BinaryMapHeader& header, uint64_t fileSize, const string& filename) {
+        if (memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) {
+            throw runtime_error("Keine binaere Kartendatei: " + filename);
         }
+        if (header.version != BINARY_VERSION) {
+            throw runtime_error("Nicht unterstuetzte Version der Kartendatei (mit MapConverter neu erzeugen): " + filename);
+        }
+        if (header.encoding > 1 || header.width == 0 || header.height == 0
+            || header.width > INT32_MAX - 256 || header.height > INT32_MAX - 2) {
+            throw runtime_error("Ungueltiger Kopf der Kartendatei: " + filename);
+        }
+        GridLayout layout = header.encoding == 1 ? GridLayout::Tiled : GridLayout::RowMajor;
+        uint64_t tileBytes = Grid<Map::Tile>::storageSize(header.width, header.height, layout);
+        uint64_t obstacleWords = ((header.width + 2 + 255) / 256) * 4;
+        uint64_t obstacleBytes = obstacleWords * (header.height + 2) * sizeof(uint64_t);
+        if (header.tileOffset % BINARY_ALIGNMENT != 0 || header.obstacleOffset % BINARY_ALIGNMENT != 0
+            || header.tileOffset < sizeof(BinaryMapHeader) || header.tileOffset + tileBytes > fileSize
+            || header.obstacleOffset < header.tileOffset + tileBytes || header.obstacleOffset + obstacleBytes > fileSize) {
+            throw runtime_error("Kartendatei ist abgeschnitten oder beschaedigt: " + filename);
+        }
+        bool startValid = header.startX >= 0 && static_cast<uint32_t>(header.startX) < header.width
+            && header.startY >= 0 && static_cast<uint32_t>(header.startY) < header.height;
+        bool goalValid = header.goalX >= 0 && static_cast<uint32_t>(header.goalX) < header.width
+            && header.goalY >= 0 && static_cast<uint32_t>(header.goalY) < header.height;
+        if ((header.startCount > 0 && !startValid) || (header.goalCount > 0 && !goalValid)) {
+            throw runtime_error("Ungueltige Start- oder Zielposition in der Kartendatei: " + filename);
+        }
+    }
 
-        tiles.push_back(row);
+    // Rand (Zeilen -1 und height, Bit 0) und Auffuellbits (ab Bit width + 1) der Hindernis-Bitmap
+    // muessen gesetzt sein, sonst lesen freeNeighbours und die Planer ueber die Karte hinaus
+    bool obstacleFrameValid(const uint64_t* bits, int words, int width, int height) {
+        size_t firstPadding = static_cast<size_t>(width) + 1;
+        uint64_t paddingMask = ~uint64_t(0) << (firstPadding & 63);
+        for (int row = 0; row < height + 2; ++row) {
+            const uint64_t* line = bits + static_cast<size_t>(row) * words;
+            size_t fullFrom = row == 0 || row == height + 1 ? 0 : (firstPadding >> 6) + 1;
+            if (fullFrom > 0 && ((line[0] & 1) == 0 || (line[fullFrom - 1] & paddingMask) != paddingMask)) {
+                return false;
+            }
+            for (size_t word = fullFrom; word < static_cast<size_t>(words); ++word) {
+                if (line[word] != ~uint64_t(0)) {
+                    return false;
+                }
+            }
+        }
+        return true;
     }
+}
 
-    file.close();
+uint64_t Map::checksum(const uint8_t* data, size_t length, uint64_t hash) {
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
 
-    if (tiles.empty()) {
-        throw runtime_error("CSV-Datei ist leer: " + filename);
+BinaryMapHeader Map::readBinaryHeader(const string& filename) {
+    ifstream file(filename, ios::binary | ios::ate);
+    if (!file.is_open()) {
+        throw runtime_error("Datei konnte nicht geoeffnet werden: " + filename);
+    }
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    BinaryMapHeader header;
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw runtime_error("Kartendatei ist zu kurz: " + filename);
     }
+    validateHeader(header, fileSize, filename);
+    return header;
+}
 
-    // Erstelle ein Map-Objekt mit den Dimensionen aus der CSV
-    int height = tiles.size();
-    int width = tiles[0].size();
-    Map map(width, height);
+Map Map::loadFromBinary(const string& filename, bool verifyChecksum) {
+    auto file = std::make_shared<MappedFile>(filename);
+    if (file->size() < sizeof(BinaryMapHeader)) {
+        throw runtime_error("Kartendatei ist zu kurz: " + filename);
+    }
+    BinaryMapHeader header;
+    memcpy(&header, file->data(), sizeof(header));
+    validateHeader(header, file->size(), filename);
 
-    // bertrage die Werte in das Map-Objekt
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            map.setTile(x, y, tiles[y][x]);
+    int width = static_cast<int>(header.width);
+    int height = static_cast<int>(header.height);
+    GridLayout layout = header.encoding == 1 ? GridLayout::Tiled : GridLayout::RowMajor;
+    Tile* tileData = file->data() + header.tileOffset;
+    int obstacleWords = obstacleWordsFor(width);
+    uint64_t* obstacleData = reinterpret_cast<uint64_t*>(file->data() + header.obstacleOffset);
+    size_t tileBytes = Grid<Tile>::storageSize(width, height, layout);
+    size_t obstacleBytes = static_cast<size_t>(obstacleWords) * (height + 2) * sizeof(uint64_t);
+    if (verifyChecksum && checksum(reinterpret_cast<const uint8_t*>(obstacleData), obstacleBytes,
+            checksum(tileData, tileBytes)) != header.checksum) {
+        throw runtime_error("Pruefsumme der Kartendatei stimmt nicht: " + filename);
+    }
+    // Immer, auch ohne Pruefsumme: die Nachbarabfragen verlassen sich auf den Rand
+    if (!obstacleFrameValid(obstacleData, obstacleWords, width, height)) {
+        throw runtime_error("Rand der Hindernis-Bitmap ist beschaedigt: " + filename);
+    }
+
+    // Beide Raster verweisen direkt in die eingeblendete Datei und halten sie am Leben
+    Grid<Tile> tiles(width, height, layout, tileData, file);
+    Grid<uint64_t> obstacles(obstacleWords, height + 2, GridLayout::RowMajor, obstacleData, file);
+
+    // Start und Ziel stehen im Kopf; nur bei mehreren Starts bzw. Zielen oder beim Pruefen
+    // werden die Kacheln durchsucht, sonst wird nur die Kachel an der Kopfposition verglichen.
+    // Die Hindernisstatistik wird erst bei Bedarf aus der Bitmap berechnet.
+    TileIndex tileIndex;
+    tileIndex.statsDirty = true;
+    if (verifyChecksum || header.startCount > 1 || header.goalCount > 1) {
+        for (int y = 0; y < height; ++y) {
+            const uint64_t* bits = obstacles.row(y + 1);
+            for (int x = 0; x < width; ++x) {
+                Tile tile = tiles.at(x, y);
+                size_t bit = static_cast<size_t>(x) + 1;
+                if (verifyChecksum && ((bits[bit >> 6] >> (bit & 63)) & 1) != static_cast<uint64_t>(tile == 1)) {
+                    throw runtime_error("Hindernis-Bitmap passt nicht zu den Kacheln: " + filename);
+                }
+                if (tile == 2) {
+                    tileIndex.starts.emplace_back(x, y);
+                }
+                else if (tile == 3) {
+                    tileIndex.goals.emplace_back(x, y);
+                }
+            }
+        }
+        if (tileIndex.starts.size() != header.startCount || tileIndex.goals.size() != header.goalCount
+            || (header.startCount > 0 && lastInScanOrder(tileIndex.starts) != make_pair(header.startX, header.startY))
+            || (header.goalCount > 0 && lastInScanOrder(tileIndex.goals) != make_pair(header.goalX, header.goalY))) {
+            throw runtime_error("Start oder Ziel im Kopf passt nicht zu den Kacheln: " + filename);
         }
     }
+    else {
+        if ((header.startCount == 1 && tiles.at(header.startX, header.startY) != 2)
+            || (header.goalCount == 1 && tiles.at(header.goalX, header.goalY) != 3)) {
+            throw runtime_error("Start oder Ziel im Kopf passt nicht zu den Kacheln: " + filename);
+        }
+        if (header.startCount == 1) {
+            tileIndex.starts.emplace_back(header.startX, header.startY);
+        }
+        if (header.goalCount == 1) {
+            tileIndex.goals.emplace_back(header.goalX, header.goalY);
+        }
+    }
+    return Map(std::move(tiles), std::move(obstacles), std::move(tileIndex));
+}
+
+void Map::saveToBinary(const string& filename) const {
+    BinaryMapHeader header = {};
+    memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.version = BINARY_VERSION;
+    header.encoding = getLayout() == GridLayout::Tiled ? 1 : 0;
+    header.width = static_cast<uint32_t>(width);
+    header.height = static_cast<uint32_t>(height);
+    header.startX = getStart().first;
+    header.startY = getStart().second;
+    header.goalX = getGoal().first;
+    header.goalY = getGoal().second;
+    header.startCount = static_cast<uint32_t>(tileIndex.starts.size());
+    header.goalCount = static_cast<uint32_t>(tileIndex.goals.size());
+    uint64_t tileBytes = tiles.size();
+    uint64_t obstacleBytes = obstacles.size() * sizeof(uint64_t);
+    header.tileOffset = alignUp(sizeof(BinaryMapHeader));
+    header.obstacleOffset = alignUp(header.tileOffset + tileBytes);
+    header.checksum = checksum(reinterpret_cast<const uint8_t*>(obstacles.data()), obstacleBytes,
+        checksum(tiles.data(), tileBytes));
+
+    ofstream file(filename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        throw runtime_error("Datei konnte nicht geoeffnet werden: " + filename);
+    }
+    const char zeros[BINARY_ALIGNMENT] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(zeros, header.tileOffset - sizeof(header));
+    file.write(reinterpret_cast<const char*>(tiles.data()), tileBytes);
+    file.write(zeros, header.obstacleOffset - header.tileOffset - tileBytes);
+    file.write(reinterpret_cast<const char*>(obstacles.data()), obstacleBytes);
+    if (!file) {
+        throw runtime_error("Fehler beim Schreiben der Kartendatei: " + filename);
+    }
+}
 
-    return map;
-}
\ No newline at end of file
+Map Map::loadFromFile(const string& filename, GridLayout layout) {
+    if (endsWith(filename, ".bmap")) {
+        return loadFromBinary(filename, true);
+    }
+    return loadFromCSV(filename, layout);
+}
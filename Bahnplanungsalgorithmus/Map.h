@@ -1,25 +1,177 @@
 #ifndef MAP_H
 #define MAP_H
+#include <cstdint>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
 #include <string>
+#include "Grid.h"
 using namespace std;
 
+// Kopf einer binaeren Kartendatei (*.bmap), 64 Byte, little-endian.
+// Danach folgen, jeweils auf 64 Byte ausgerichtet, die Kacheln (1 Byte pro Kachel
+// in der Speicheranordnung aus encoding) und die Hindernis-Bitmap von Map
+// (getObstacleWordsPerRow() * (height + 2) Woerter). Beide Abschnitte werden
+// beim Laden per mmap direkt verwendet, ohne sie zu parsen oder zu kopieren.
+struct BinaryMapHeader {
+    char magic[4];              // "BMAP"
+    uint16_t version;           // derzeit 2
+    uint8_t encoding;           // 0 = RowMajor, 1 = Tiled (8x8-Bloecke)
+    uint8_t reserved;
+    uint32_t width, height;
+    int32_t startX, startY;     // Map::getStart(), -1 wenn die Karte keinen Start enthaelt
+    int32_t goalX, goalY;       // Map::getGoal(), -1 wenn die Karte kein Ziel enthaelt
+    uint64_t tileOffset;        // Byte-Offset der Kacheln ab Dateianfang
+    uint64_t obstacleOffset;    // Byte-Offset der Hindernis-Bitmap
+    uint64_t checksum;          // FNV-1a (64 Bit) ueber die Kachelbytes, dann die Bitmap-Bytes
+    uint32_t startCount;        // Anzahl der Start- bzw. Zielkacheln
+    uint32_t goalCount;
+};
+static_assert(sizeof(BinaryMapHeader) == 64, "BinaryMapHeader muss 64 Byte gross sein");
+
+// Kleinstes Rechteck, das alle Hindernisse enthaelt (leer: minX > maxX)
+struct ObstacleBounds {
+    int minX, minY, maxX, maxY;
+    bool empty() const { return minX > maxX; }
+};
+
 class Map {
 public:
-    Map(int width, int height);
+    // Kachelwerte: 0 = frei, 1 = Hindernis, 2 = Start, 3 = Ziel
+    using Tile = uint8_t;
+
+    Map(int width, int height, GridLayout layout = GridLayout::RowMajor);
     void setTile(int x, int y, int value);
     int getTile(int x, int y) const;
     int getWidth() const;
     int getHeight() const;
     void addFrame();
-    Map loadFromCSV(const string& filename);
+    static Map loadFromCSV(const string& filename, GridLayout layout = GridLayout::RowMajor);
+
+    // Binaeres Kartenformat (siehe BinaryMapHeader). loadFromBinary blendet die Datei
+    // per mmap ein und arbeitet direkt auf den eingeblendeten Seiten; Aenderungen ueber
+    // setTile bleiben privat und werden nicht in die Datei geschrieben. Rand und Auffuellbits
+    // der Bitmap sowie die Kacheln an Start- und Zielposition des Kopfes werden immer geprueft.
+    // Mit verifyChecksum zusaetzlich die Pruefsumme und ob Bitmap, Start und Ziel zu den
+    // Kacheln passen; das liest jede Seite der Datei.
+    static Map loadFromBinary(const string& filename, bool verifyChecksum = false);
+    void saveToBinary(const string& filename) const;
+    static BinaryMapHeader readBinaryHeader(const string& filename);
+    // FNV-1a; hash = Ergebnis eines vorherigen Abschnitts, um mehrere Abschnitte zu verketten
+    static uint64_t checksum(const uint8_t* data, size_t length, uint64_t hash = 14695981039346656037ull);
+
+    // Laedt *.bmap binaer (mit Pruefung, loadFromBinary(filename, true)), alles andere als CSV.
+    // Bei Binaerdateien bestimmt die Datei die Speicheranordnung, layout gilt nur fuer CSV.
+    static Map loadFromFile(const string& filename, GridLayout layout = GridLayout::RowMajor);
+    GridLayout getLayout() const { return tiles.getLayout(); }
+
+    // Verzeichnis der Start- und Zielkacheln sowie Hindernisstatistik. Wird beim Laden
+    // miterstellt und von setTile aktuell gehalten, die Abfragen kosten O(1).
+    // Gibt es mehrere Starts bzw. Ziele, liefern getStart/getGoal die in Zeilenrichtung
+    // letzte Kachel (wie der fruehere Suchlauf der Algorithmen), sonst (-1, -1).
+    bool hasStart() const { return !tileIndex.starts.empty(); }
+    bool hasGoal() const { return !tileIndex.goals.empty(); }
+    pair<int, int> getStart() const { return lastInScanOrder(tileIndex.starts); }
+    pair<int, int> getGoal() const { return lastInScanOrder(tileIndex.goals); }
+    const vector<pair<int, int>>& getStarts() const { return tileIndex.starts; }
+    const vector<pair<int, int>>& getGoals() const { return tileIndex.goals; }
+    size_t getObstacleCount() const;
+    ObstacleBounds getObstacleBounds() const;
+
+    // Linearer Index (gemaess Speicheranordnung) und Rueckrechnung in Koordinaten.
+    // Arbeitsraster mit derselben Anordnung (Grid<T>(w, h, v, map.getLayout()))
+    // koennen mit denselben Indizes angesprochen werden.
+    size_t index(int x, int y) const { return tiles.index(x, y); }
+    int indexToX(size_t i) const { return tiles.indexToX(i); }
+    int indexToY(size_t i) const { return tiles.indexToY(i); }
+    size_t size() const { return tiles.size(); }
+
+    // Schneller Lesezugriff ohne Bereichspruefung
+    Tile at(int x, int y) const { return tiles.at(x, y); }
+    Tile at(size_t i) const { return tiles.at(i); }
+
+    // Rohzeiger auf eine Zeile (getWidth() Kacheln, nur bei RowMajor) bzw. das gesamte Raster
+    const Tile* row(int y) const { return tiles.row(y); }
+    const Grid<Tile>& getTiles() const { return tiles; }
+
+    // Hindernis-Bitmap mit 1 Bit pro Kachel (1 = Hindernis), wird von setTile
+    // mitgefuehrt. Die Bitmap ist von einem Rand aus Hindernissen umgeben:
+    // Spalte x liegt auf Bit x + 1 und y darf von -1 bis getHeight() reichen,
+    // so dass Nachbarabfragen ohne Bereichspruefung auskommen. Jede Zeile ist
+    // auf ein Vielfaches von 256 Bit aufgefuellt und kann daher ohne Resthandling
+    // in 64-Bit-Woertern oder SIMD-Registern (z. B. _mm256_loadu_si256) gelesen werden.
+    bool isObstacle(int x, int y) const {
+        size_t bit = static_cast<size_t>(x) + 1;
+        return (obstacleRow(y)[bit >> 6] >> (bit & 63)) & 1;
+    }
+    const uint64_t* obstacleRow(int y) const {
+        return obstacles.row(y + 1);
+    }
+    int getObstacleWordsPerRow() const { return obstacleWords; }
+
+    // Freie Nachbarn als Bitmaske: Bit 0 = oben, 1 = unten, 2 = links, 3 = rechts.
+    // Vier Bittests statt vier Kachelzugriffe mit Bereichspruefung.
+    unsigned freeNeighbours(int x, int y) const {
+        size_t bit = static_cast<size_t>(x) + 1;
+        const uint64_t* above = obstacleRow(y - 1);
+        const uint64_t* here = obstacleRow(y);
+        const uint64_t* below = obstacleRow(y + 1);
+        unsigned blocked = static_cast<unsigned>((above[bit >> 6] >> (bit & 63)) & 1)
+            | static_cast<unsigned>((below[bit >> 6] >> (bit & 63)) & 1) << 1
+            | static_cast<unsigned>((here[(bit - 1) >> 6] >> ((bit - 1) & 63)) & 1) << 2
+            | static_cast<unsigned>((here[(bit + 1) >> 6] >> ((bit + 1) & 63)) & 1) << 3;
+        return ~blocked & 0xFu;
+    }
+
+    // Wie freeNeighbours, zusaetzlich die Diagonalen ohne Eckenschneiden: Bit 4 = oben links,
+    // 5 = oben rechts, 6 = unten links, 7 = unten rechts. Ein diagonaler Zug ist nur frei,
+    // wenn das Zielfeld und beide angrenzenden geraden Nachbarn frei sind.
+    unsigned freeNeighbours8(int x, int y) const {
+        size_t bit = static_cast<size_t>(x) + 1;
+        const uint64_t* above = obstacleRow(y - 1);
+        const uint64_t* below = obstacleRow(y + 1);
+        unsigned straight = freeNeighbours(x, y);
+        unsigned blocked = static_cast<unsigned>((above[(bit - 1) >> 6] >> ((bit - 1) & 63)) & 1)
+            | static_cast<unsigned>((above[(bit + 1) >> 6] >> ((bit + 1) & 63)) & 1) << 1
+            | static_cast<unsigned>((below[(bit - 1) >> 6] >> ((bit - 1) & 63)) & 1) << 2
+            | static_cast<unsigned>((below[(bit + 1) >> 6] >> ((bit + 1) & 63)) & 1) << 3;
+        unsigned up = straight & 1u, down = (straight >> 1) & 1u;
+        unsigned left = (straight >> 2) & 1u, right = (straight >> 3) & 1u;
+        unsigned corners = (up & left) | (up & right) << 1 | (down & left) << 2 | (down & right) << 3;
+        return straight | (~blocked & corners) << 4;
+    }
 
 private:
+    // Positionen (x, y) besonderer Kacheln und Hindernisstatistik
+    struct TileIndex {
+        vector<pair<int, int>> starts;
+        vector<pair<int, int>> goals;
+        size_t obstacleCount = 0;
+        ObstacleBounds bounds = { 0, 0, -1, -1 };
+        // Zaehler und Rechteck muessen aus der Bitmap neu berechnet werden (z. B. nach
+        // dem Entfernen eines Hindernisses am Rand des Rechtecks)
+        bool statsDirty = false;
+
+        // Traegt eine Kartenzeile ein und baut dabei ihre Bitmap-Zeile (mit Auffuellbits) auf
+        void addRow(int y, const Tile* row, int width, uint64_t* bits, int words);
+        void addStats(int y, const uint64_t* bits, int words, int width);
+    };
+
+    // Karte aus fertigen Rastern (z. B. ueber einer eingeblendeten Datei)
+    Map(Grid<Tile> tiles, Grid<uint64_t> obstacles, TileIndex tileIndex);
+    static int obstacleWordsFor(int width) { return ((width + 2 + 255) / 256) * 4; }
+    static pair<int, int> lastInScanOrder(const vector<pair<int, int>>& positions);
+    void initObstacleBorder();
+    void setObstacleBit(int x, int y, bool obstacle);
+    void updateIndex(int x, int y, Tile oldValue, Tile newValue);
+    void recomputeStats() const;
+
     int width, height;
-    std::vector<std::vector<int>> tiles;
+    Grid<Tile> tiles;
+    int obstacleWords;              // 64-Bit-Woerter pro Bitmap-Zeile
+    Grid<uint64_t> obstacles;       // obstacleWords x (height + 2) Woerter
+    mutable TileIndex tileIndex;
 };
 
 #endif
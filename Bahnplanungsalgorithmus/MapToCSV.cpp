@@ -1,6 +1,7 @@
 #include "MapToCSV.h"
 #include <fstream>
 #include <stdexcept>
+#include <string>
 
 // Konstruktor: Nimmt eine Referenz auf eine Map entgegen
 MapToCSV::MapToCSV(const Map& map) : map(map) {}
@@ -10,18 +11,23 @@ void MapToCSV::exportToFile(const std::string& filename) const {
     std::ofstream outFile(filename);
 
     if (!outFile.is_open()) {
-        throw std::runtime_error("Fehler beim ffnen der Datei: " + filename);
+        throw std::runtime_error("Fehler beim Öffnen der Datei: " + filename);
     }
 
-    // Gehe durch die Kacheln der Map und schreibe sie in die Datei
+    // Gehe zeilenweise durch die Kacheln der Map und schreibe sie in die Datei
+    std::string line;
+    std::vector<Map::Tile> row(map.getWidth());
     for (int y = 0; y < map.getHeight(); ++y) {
+        map.getTiles().copyRow(y, row.data());
+        line.clear();
         for (int x = 0; x < map.getWidth(); ++x) {
-            outFile << map.getTile(x, y);
+            line += std::to_string(static_cast<int>(row[x])); // auch mehrstellige Kachelwerte
             if (x < map.getWidth() - 1) {
-                outFile << ","; // Komma nach jedem Wert auer am Ende der Zeile
+                line += ','; // Komma nach jedem Wert außer am Ende der Zeile
             }
         }
-        outFile << "\n"; // Neue Zeile nach jeder Zeile der Map
+        line += '\n'; // Neue Zeile nach jeder Zeile der Map
+        outFile << line;
     }
 
     outFile.close();
@@ -1,10 +1,16 @@
 #include "MapWindow.h"
 #include "MapToCSV.h"
+#include <algorithm>
+#include <chrono>
+#include "gridplan/Planners.h"
+#include "gridplan/ResultWriter.h"
 #include <iostream>
 
 
 // Konstruktor
-MapWindow::MapWindow(Map& map, vector<Algorithm>& algorithms) : map(map), button(sf::Vector2f(100, 30)), buttonText("Action", font, 20), algorithms(algorithms) {
+MapWindow::MapWindow(Map& map, vector<Algorithm>& algorithms) : map(map), hierarchy(map), button(sf::Vector2f(100, 30)), buttonText("Action", font, 20), algorithms(algorithms) {
+
+    clearance.reset(map);
 
     tileSize = 20;
     if (map.getWidth() > 50) {
@@ -27,12 +33,12 @@ MapWindow::MapWindow(Map& map, vector<Algorithm>& algorithms) : map(map), button
     button.setOutlineThickness(2);
     button.setOutlineColor(sf::Color::White);
 
-    // Text fr den Button
+    // Text für den Button
     buttonText.setFillColor(sf::Color::White);
     buttonText.setPosition(map.getWidth() * tileSize + 20, map.getHeight() * tileSize); // Zentriert auf dem Button
 }
 
-// Luft die Hauptschleife fr das Fenster
+// Läuft die Hauptschleife für das Fenster
 void MapWindow::run() {
     while (window.isOpen()) {
         handleEvents();
@@ -59,15 +65,21 @@ void MapWindow::draw() {
             tile.setOutlineThickness(1);
             tile.setOutlineColor(sf::Color::Black);
 
-            if (map.getTile(x, y) == 1) {
+            Map::Tile value = map.at(x, y);
+            if (value == 1) {
                 tile.setFillColor(sf::Color::Black); // Hindernisse
             }
-            else if (map.getTile(x, y) == 2) {
+            else if (value == 2) {
                 tile.setFillColor(sf::Color::Blue); // Start
             }
-            else if (map.getTile(x, y) == 3) {
+            else if (value == 3) {
                 tile.setFillColor(sf::Color::Green); // Ziel
             }
+            else if (showClearance && clearance.distances().at(x, y) > 0) {
+                // Freiraum: nahe an Hindernissen rot, nach außen heller
+                int shade = std::min(255, 80 + 25 * clearance.distances().at(x, y));
+                tile.setFillColor(sf::Color(255, shade, shade));
+            }
             else {
                 tile.setFillColor(sf::Color::White); // Freie Felder
             }
@@ -93,11 +105,16 @@ void MapWindow::handleEvents() {
             window.close();
         }
 
+        // Taste C: Freiraumanzeige ein-/ausschalten
+        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::C) {
+            showClearance = !showClearance;
+        }
+
         // Mausereignis: Linksklick
         if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
             sf::Vector2i mousePos = sf::Mouse::getPosition(window);
 
-            // Prfe, ob ein Kartenfeld angeklickt wurde
+            // Prüfe, ob ein Kartenfeld angeklickt wurde
             if (mousePos.y < map.getHeight() * tileSize) {
                 int x = mousePos.x / tileSize;
                 int y = mousePos.y / tileSize;
@@ -105,15 +122,16 @@ void MapWindow::handleEvents() {
                 // Kachel umschalten (0 zu 1 oder 1 zu 0)
                 int currentValue = map.getTile(x, y);
                 map.setTile(x, y, currentValue == 0 ? 1 : 0);
+                onTileChanged(x, y);
             }
 
-            // Prfe, ob der Button angeklickt wurde
+            // Prüfe, ob der Button angeklickt wurde
             if (button.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                 onButtonClick();
             }
 
-            // Prfe, ob eine Checkbox angeklickt wurde
-            for (int i = 0; i < 12; ++i) {
+            // Prüfe, ob eine Checkbox angeklickt wurde
+            for (int i = 0; i < 15; ++i) {
                 if (checkbox[i].getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                     checkboxState[i] = !checkboxState[i];
                     checkbox[i].setFillColor(checkboxState[i] ? sf::Color::Green : sf::Color::White);
@@ -124,30 +142,28 @@ void MapWindow::handleEvents() {
         if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Right) {
             sf::Vector2i mousePos = sf::Mouse::getPosition(window);
 
-            // Prfe, ob ein Kartenfeld angeklickt wurde
+            // Prüfe, ob ein Kartenfeld angeklickt wurde
             if (mousePos.y < map.getHeight() * tileSize) {
                 int x = mousePos.x / tileSize;
                 int y = mousePos.y / tileSize;
 
-                // Wenn auf ein existierendes Startfeld geklickt wird, zurcksetzen
+                // Wenn auf ein existierendes Startfeld geklickt wird, zurücksetzen
                 if (map.getTile(x, y) == 2) {
                     map.setTile(x, y, 0);
                 }
                 else {
-                    // Vorherige Startfelder zurcksetzen
-                    for (int row = 0; row < map.getHeight(); ++row) {
-                        for (int col = 0; col < map.getWidth(); ++col) {
-                            if (map.getTile(col, row) == 2) {
-                                map.setTile(col, row, 0);
-                            }
-                        }
+                    // Vorherige Startfelder zurücksetzen (Kopie, da setTile den Index ändert)
+                    vector<pair<int, int>> starts = map.getStarts();
+                    for (const auto& start : starts) {
+                        map.setTile(start.first, start.second, 0);
                     }
                     // Neues Startfeld setzen
                     map.setTile(x, y, 2);
                 }
+                onTileChanged(x, y);  // ein Hindernis kann zum Startfeld werden
             }
 
-            // Prfe, ob der Button angeklickt wurde
+            // Prüfe, ob der Button angeklickt wurde
             if (button.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                 onButtonClick();
             }
@@ -157,7 +173,7 @@ void MapWindow::handleEvents() {
         if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Middle) {
             sf::Vector2i mousePos = sf::Mouse::getPosition(window);
 
-            // Prfe, ob ein Kartenfeld angeklickt wurde
+            // Prüfe, ob ein Kartenfeld angeklickt wurde
             if (mousePos.y < map.getHeight() * tileSize) {
                 int x = mousePos.x / tileSize;
                 int y = mousePos.y / tileSize;
@@ -166,20 +182,18 @@ void MapWindow::handleEvents() {
                     map.setTile(x, y, 0);
                 }
                 else {
-                    // Vorherige Zielfelder zurcksetzen
-                    for (int row = 0; row < map.getHeight(); ++row) {
-                        for (int col = 0; col < map.getWidth(); ++col) {
-                            if (map.getTile(col, row) == 3) {
-                                map.setTile(col, row, 0);
-                            }
-                        }
+                    // Vorherige Zielfelder zurücksetzen (Kopie, da setTile den Index ändert)
+                    vector<pair<int, int>> goals = map.getGoals();
+                    for (const auto& goal : goals) {
+                        map.setTile(goal.first, goal.second, 0);
                     }
                     // Neues Zielfeld setzen
                     map.setTile(x, y, 3);
                 }
+                onTileChanged(x, y);
             }
 
-            // Prfe, ob der Button angeklickt wurde
+            // Prüfe, ob der Button angeklickt wurde
             if (button.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                 onButtonClick();
             }
@@ -190,6 +204,17 @@ void MapWindow::handleEvents() {
     }
 }
 
+void MapWindow::onTileChanged(int x, int y) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    size_t touched = clearance.update(map, x, y);
+    auto endTime = std::chrono::high_resolution_clock::now();
+    if (showClearance && touched > 0) {
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
+        std::cout << "Freiraum aktualisiert: " << touched << " Felder in " << duration.count() / 1000.0 << " us" << std::endl;
+    }
+    hierarchy.updateTile(x, y);
+}
+
 void MapWindow::createAlgorithms(int i) {
     string name;
     string language;
@@ -205,6 +230,9 @@ void MapWindow::createAlgorithms(int i) {
     else if (i / 3 == 3) {
         name = "AStarMH";
     }
+    else if (i / 3 == 4) {
+        name = "HPAStar";
+    }
     if (i % 3 == 0) {
         language = "Java";
     }
@@ -218,7 +246,7 @@ void MapWindow::createAlgorithms(int i) {
 }
 
 void MapWindow::onButtonClick() {
-    std::cout << "Button wurde gedrckt! Aktion ausfhren..." << std::endl;
+    std::cout << "Button wurde gedrückt! Aktion ausführen..." << std::endl;
 
     // Karte exportieren
     try {
@@ -232,42 +260,85 @@ void MapWindow::onButtonClick() {
     }
 
     //check checkbox State
-    for (int i = 0; i < 12; i++) {
+    for (int i = 0; i < 15; i++) {
         if (checkboxState[i] == true) {
             createAlgorithms(i);
         }
     }
 
-    // Python-Skript starten
-    std::cout << "Starte das Python-Skript fr Bahnplanung..." << std::endl;
+    // C++-Algorithmen laufen direkt im Prozess, Java und Python über das Python-Skript
     string command = "python3 run_algorithms.py ";
+    bool scriptNeeded = false;
 
-    // Fge alle Algorithmen zur Kommandozeile hinzu
+    // Füge alle Algorithmen zur Kommandozeile hinzu
     for (const auto& alg : algorithms) {
-        command += "\"" + alg.getName() + ":" + alg.getLanguage() + "\" ";  // bergabe im Format "Name:Sprache"
+        if (alg.getLanguage() == "Cpp") {
+            runCppAlgorithm(alg.getName());
+            continue;
+        }
+        command += "\"" + alg.getName() + ":" + alg.getLanguage() + "\" ";  // Übergabe im Format "Name:Sprache"
+        scriptNeeded = true;
     }
 
-    // bergibt den Befehl an das System, um das Python-Skript auszufhren
-    std::cout << command.c_str() << std::endl;
-    int scriptStatus = system(command.c_str());
-    if (scriptStatus == 0) {
-        std::cout << "Python-Skript erfolgreich ausgefhrt." << std::endl;
+    if (scriptNeeded) {
+        // Übergibt den Befehl an das System, um das Python-Skript auszuführen
+        std::cout << "Starte das Python-Skript für Bahnplanung..." << std::endl;
+        std::cout << command.c_str() << std::endl;
+        int scriptStatus = system(command.c_str());
+        if (scriptStatus == 0) {
+            std::cout << "Python-Skript erfolgreich ausgeführt." << std::endl;
+        }
+        else {
+            std::cerr << "Fehler beim Ausfuehren des Python-Skripts." << std::endl;
+        }
+    }
+    close();
+}
+
+void MapWindow::runCppAlgorithm(const string& name) {
+    // Einzelmessung wie bei den Programmen ohne --repeat; wiederholte Messungen ueber die Kommandozeile
+    gridplan::RepeatOptions repeat;
+
+    gridplan::PlanResult result;
+    // Zuordnung der Heuristiken wie in run_algorithms.py
+    if (name == "Wavefront") {
+        result = gridplan::runWavefront(map, repeat);
+    }
+    else if (name == "Brushfire") {
+        result = gridplan::runBrushfire(map, repeat);
+    }
+    else if (name == "AStarAP") {
+        result = gridplan::runAStar(map, "manhattan", repeat);
+    }
+    else if (name == "AStarMH") {
+        result = gridplan::runAStar(map, "airplane", repeat);
+    }
+    else if (name == "HPAStar") {
+        // Die Abstraktion wird beim Bearbeiten der Karte laufend nachgefuehrt, nicht neu aufgebaut
+        result = gridplan::runHpaStar(hierarchy, map, repeat);
     }
     else {
-        std::cerr << "Fehler beim Ausfuehren des Python-Skripts." << std::endl;
+        std::cerr << "Unbekannter Algorithmus: " << name << std::endl;
+        return;
     }
-    close();
+
+    // Wie die Programme: ohne Start oder Ziel wird keine Ergebnisdatei geschrieben
+    if (result.statusCode == 402 || result.statusCode == 403) {
+        std::cout << name << " (Cpp): " << (result.statusCode == 402 ? "Start" : "Ziel") << " nicht gefunden!" << std::endl;
+        return;
+    }
+    gridplan::saveResultsToJson(result, "result_" + name + "_Cpp.json");
 }
 
 // Zeichnet die Checkboxen
 void MapWindow::drawCheckboxes() {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 15; ++i) {
         window.draw(checkbox[i]);
     }
     for (int i = 0; i < 3; ++i) {
         window.draw(lang_label[i]);
     }
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < 5; ++i) {
         window.draw(alg_label[i]);
     }
 }
@@ -276,7 +347,7 @@ void MapWindow::initCheckboxes() {
     //Labels erstellen
     int xStart = map.getWidth() * tileSize + 50;
 
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < 5; i++) {
         alg_label[i].setFont(font);
         alg_label[i].setCharacterSize(18);
         alg_label[i].setFillColor(sf::Color::Black);
@@ -294,12 +365,13 @@ void MapWindow::initCheckboxes() {
     alg_label[1].setString("bf");
     alg_label[2].setString("a* ap");
     alg_label[3].setString("a* mh");
+    alg_label[4].setString("hpa*");
     lang_label[0].setString("Java");
     lang_label[1].setString("Pyth");
     lang_label[2].setString("Cpp");
 
     // Checkboxen erstellen
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 15; ++i) {
         checkbox[i].setSize(sf::Vector2f(20, 20));
         checkbox[i].setFillColor(sf::Color::White);
         checkbox[i].setOutlineThickness(2);
@@ -307,7 +379,7 @@ void MapWindow::initCheckboxes() {
         checkboxState[i] = false;
     }
     // Position der Checkboxen
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < 5; ++i) {
         for (int j = 0; j < 3; ++j) {
             checkbox[i * 3 + j].setPosition(xStart + 40 + j * 60, 100 + i * 40);  // 3x3 Raster
         }
@@ -5,6 +5,8 @@
 #include "Map.h"
 #include <iostream>
 #include "Algorithm.h"
+#include "gridplan/DynamicBrushfire.h"
+#include "gridplan/HpaStar.h"
 
 class MapWindow {
 public:
@@ -21,10 +23,10 @@ private:
     // Handhabung von Ereignissen (z. B. Maus- oder Tastaturaktionen)
     void handleEvents();
 
-    // Zeichnet die Karte und die Benutzeroberflche
+    // Zeichnet die Karte und die Benutzeroberfläche
     void draw();
 
-    // Methode, die bei einem Button-Klick ausgefhrt wird
+    // Methode, die bei einem Button-Klick ausgeführt wird
     void onButtonClick();
 
     // Labels und Checkboxen erstellen
@@ -36,18 +38,34 @@ private:
 
     void createAlgorithms(int i);
 
+    // Repariert das Freiraumfeld und die HPA*-Abstraktion nach einer Änderung der Kachel (x, y)
+    void onTileChanged(int x, int y);
+
+    // Führt einen C++-Algorithmus direkt im Prozess über gridplan aus und schreibt
+    // result_<Name>_Cpp.json, wie es run_algorithms.py für die Programme tun würde
+    void runCppAlgorithm(const string& name);
+
     // Referenz zur Karte
     Map& map;
 
+    // Abstand jeder Kachel zum nächsten Hindernis, wird bei jedem Klick repariert statt neu berechnet
+    gridplan::DynamicBrushfire clearance;
+
+    // HPA*-Abstraktion der Karte; bei einer Änderung wird nur der betroffene Cluster neu aufgebaut
+    gridplan::HpaStar hierarchy;
+
+    // Freiraum statt weißer Felder anzeigen (Taste C)
+    bool showClearance = false;
+
     int tileSize;
     
-    //Vektor fr Algortihmen
+    //Vektor für Algortihmen
     vector<Algorithm>& algorithms;
 
     // SFML-Fenster
     sf::RenderWindow window;
 
-    // Schriftart fr den Button-Text
+    // Schriftart für den Button-Text
     sf::Font font;
 
     // Button (Rechteckform)
@@ -56,15 +74,15 @@ private:
     // Button-Text
     sf::Text buttonText;
 
-    // Labels fr die Algorithmen
-    sf::Text alg_label[4] = {};
+    // Labels für die Algorithmen
+    sf::Text alg_label[5] = {};
 
-    // Labels fr Programmiersprachen
+    // Labels für Programmiersprachen
     sf::Text lang_label[3] = {};
 
-    // Checkboxen fr Auswahl
-    sf::RectangleShape checkbox[12];  // Array fr 12 Checkboxen
-    bool checkboxState[12] = {false};           // Zustand der Checkboxen
+    // Checkboxen für Auswahl
+    sf::RectangleShape checkbox[15];  // Array für 15 Checkboxen
+    bool checkboxState[15] = {false};           // Zustand der Checkboxen
 };
 
 
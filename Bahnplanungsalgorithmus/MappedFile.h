@@ -0,0 +1,32 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Blendet eine Datei per mmap (bzw. MapViewOfFile unter Windows) in den Speicher ein.
+// Die Seiten werden privat (copy-on-write) eingeblendet: Schreibzugriffe sind erlaubt,
+// landen aber nie in der Datei. Es wird erst beim ersten Zugriff auf eine Seite gelesen.
+class MappedFile {
+public:
+    // Wirft runtime_error, wenn die Datei nicht geoeffnet oder eingeblendet werden kann
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    uint8_t* data() const { return address; }
+    size_t size() const { return length; }
+
+private:
+    uint8_t* address = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+#endif
@@ -0,0 +1,211 @@
+#include "ParseCsv.h"
+#include <cstring>
+#include <stdexcept>
+#include "BitOps.h"
+#include "MappedFile.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PARSECSV_SSE2
+#endif
+
+namespace {
+    const size_t BLOCK_SIZE = 64;
+
+    // Bit i ist gesetzt, wenn Byte i des Blocks ein Komma, ein Zeilenumbruch bzw. eine Ziffer ist
+    struct BlockMasks {
+        uint64_t comma;
+        uint64_t newline;
+        uint64_t digit;
+    };
+
+    inline bool isDigit(char c) {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    BlockMasks classifyBlock(const char* block) {
+        BlockMasks masks = { 0, 0, 0 };
+#ifdef PARSECSV_SSE2
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i newline = _mm_set1_epi8('\n');
+        const __m128i belowZero = _mm_set1_epi8('0' - 1);
+        const __m128i aboveNine = _mm_set1_epi8('9' + 1);
+        for (int i = 0; i < 4; ++i) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, belowZero), _mm_cmplt_epi8(chunk, aboveNine));
+            int shift = 16 * i;
+            masks.comma |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, comma)))) << shift;
+            masks.newline |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)))) << shift;
+            masks.digit |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(digit))) << shift;
+        }
+#else
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            uint64_t bit = uint64_t(1) << i;
+            masks.comma |= block[i] == ',' ? bit : 0;
+            masks.newline |= block[i] == '\n' ? bit : 0;
+            masks.digit |= isDigit(block[i]) ? bit : 0;
+        }
+#endif
+        return masks;
+    }
+
+    class CsvParser {
+    public:
+        CsvParser(const char* data, size_t length, const std::string& name, const CsvRowCallback& onRow)
+            : data(data), length(length), name(name), onRow(onRow) {
+            result.cells.reserve(length / 2 + 1);
+        }
+
+        // Verarbeitet alle Trenner eines Blocks, der bei Byte offset beginnt
+        void processBlock(size_t offset, const BlockMasks& masks) {
+            uint64_t separators = masks.comma | masks.newline;
+            // Trenner, denen direkt eine Ziffer vorausgeht (Bit 0 haengt am Vorgaengerblock)
+            uint64_t afterDigit = (masks.digit << 1) | (offset > 0 && isDigit(data[offset - 1]) ? 1 : 0);
+            while (separators != 0) {
+                int bit = countTrailingZeros(separators);
+                separators &= separators - 1;
+                size_t pos = offset + bit;
+                bool newline = ((masks.newline >> bit) & 1) != 0;
+                if (pos - tokenStart == 1 && ((afterDigit >> bit) & 1) && blankLines == 0) {
+                    // Schneller Pfad: genau eine Ziffer
+                    result.cells.push_back(static_cast<uint8_t>(data[tokenStart] - '0'));
+                    ++column;
+                    tokenStart = pos + 1;
+                    if (newline) {
+                        endLine();
+                    }
+                    continue;
+                }
+                separator(pos, newline, ((afterDigit >> bit) & 1) != 0);
+            }
+        }
+
+        CsvMap finish() {
+            // Letzte Zeile ohne abschliessenden Zeilenumbruch
+            if (tokenStart < length) {
+                separator(length, true, isDigit(data[length - 1]));
+            }
+            if (result.height == 0) {
+                throw std::runtime_error("CSV-Datei ist leer: " + name);
+            }
+            return std::move(result);
+        }
+
+    private:
+        // Wert zwischen tokenStart und pos abschliessen; pos ist ein Komma oder Zeilenende
+        void separator(size_t pos, bool endOfLine, bool digitBefore) {
+            if (pos - tokenStart == 1 && digitBefore) {
+                // Schneller Pfad: genau eine Ziffer
+                addValue(static_cast<uint8_t>(data[tokenStart] - '0'));
+            }
+            else if (!isBlank(tokenStart, pos)) {
+                addValue(parseToken(tokenStart, pos));
+            }
+            else if (!endOfLine) {
+                fail("leerer Wert");
+            }
+            // Leerer Wert am Zeilenende: Komma am Zeilenende bzw. Leerzeile, wird ignoriert
+            tokenStart = pos + 1;
+            if (endOfLine) {
+                endLine();
+            }
+        }
+
+        void addValue(uint8_t value) {
+            if (blankLines > 0) {
+                line -= blankLines;
+                fail("leere Zeile innerhalb der Karte");
+            }
+            result.cells.push_back(value);
+            ++column;
+        }
+
+        void endLine() {
+            if (column == 0) {
+                ++blankLines;
+            }
+            else {
+                if (result.height == 0) {
+                    result.width = column;
+                }
+                else if (column != result.width) {
+                    fail(std::to_string(column) + " Werte, erwartet " + std::to_string(result.width));
+                }
+                if (onRow) {
+                    onRow(result.height, result.cells.data() + result.cells.size() - column, column);
+                }
+                ++result.height;
+            }
+            column = 0;
+            ++line;
+        }
+
+        bool isBlank(size_t begin, size_t end) const {
+            for (size_t i = begin; i < end; ++i) {
+                if (data[i] != ' ' && data[i] != '\t' && data[i] != '\r') {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Langsamer Pfad: mehrstellige Werte, umgebende Leerzeichen und '\r'
+        uint8_t parseToken(size_t begin, size_t end) {
+            size_t i = begin;
+            while (i < end && (data[i] == ' ' || data[i] == '\t')) {
+                ++i;
+            }
+            if (i < end && data[i] == '+') {
+                ++i;
+            }
+            int value = 0;
+            size_t digits = 0;
+            while (i < end && isDigit(data[i]) && value <= 255) {
+                value = value * 10 + (data[i] - '0');
+                ++i;
+                ++digits;
+            }
+            while (i < end && (data[i] == ' ' || data[i] == '\t' || data[i] == '\r')) {
+                ++i;
+            }
+            if (digits == 0 || i != end || value > 255) {
+                fail("ungueltiger Wert '" + std::string(data + begin, end - begin) + "'");
+            }
+            return static_cast<uint8_t>(value);
+        }
+
+        [[noreturn]] void fail(const std::string& message) const {
+            throw std::runtime_error(name + ", Zeile " + std::to_string(line) + ": " + message);
+        }
+
+        const char* data;
+        size_t length;
+        const std::string& name;
+        const CsvRowCallback& onRow;
+        CsvMap result;
+        size_t tokenStart = 0;
+        int column = 0;
+        int line = 1;
+        int blankLines = 0;         // Leerzeilen seit der letzten Kartenzeile
+    };
+}
+
+CsvMap parseCsvMap(const char* data, size_t length, const std::string& name, const CsvRowCallback& onRow) {
+    CsvParser parser(data, length, name, onRow);
+    size_t fullBlocks = length - length % BLOCK_SIZE;
+    for (size_t offset = 0; offset < fullBlocks; offset += BLOCK_SIZE) {
+        parser.processBlock(offset, classifyBlock(data + offset));
+    }
+    if (fullBlocks < length) {
+        // Rest in einen mit Nullen aufgefuellten Block kopieren, damit nicht ueber das Ende gelesen wird
+        char tail[BLOCK_SIZE] = {};
+        memcpy(tail, data + fullBlocks, length - fullBlocks);
+        parser.processBlock(fullBlocks, classifyBlock(tail));
+    }
+    return parser.finish();
+}
+
+CsvMap parseCsvFile(const std::string& filename, const CsvRowCallback& onRow) {
+    MappedFile file(filename);
+    return parseCsvMap(reinterpret_cast<const char*>(file.data()), file.size(), filename, onRow);
+}
@@ -0,0 +1,34 @@
+#ifndef PARSECSV_H
+#define PARSECSV_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Ergebnis von parseCsvMap: Kacheln zeilenweise, width * height Werte
+struct CsvMap {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> cells;
+};
+
+// Liest eine Karte im CSV-Format (Werte 0 bis 255, durch Kommata getrennt, eine
+// Kartenzeile pro Textzeile) in einem einzigen Durchlauf. Kommata, Zeilenumbrueche
+// und Ziffern werden blockweise (64 Byte) mit SSE2 klassifiziert; einstellige Werte
+// werden direkt uebernommen, nur laengere Werte oder Werte mit Leerzeichen bzw. '\r'
+// gehen ueber den langsamen Pfad. Ein Komma am Zeilenende und Leerzeilen am
+// Dateiende werden ignoriert.
+// Wirft runtime_error mit Zeilennummer bei ungueltigen oder leeren Werten und bei
+// Zeilen mit abweichender Anzahl an Werten.
+// onRow wird nach jeder fertigen Zeile aufgerufen (y, Zeiger auf die width Werte der
+// Zeile, width), solange die Zeile noch im Cache liegt. So koennen Aufrufer weitere
+// Daten im selben Durchlauf aufbauen.
+using CsvRowCallback = std::function<void(int y, const uint8_t* row, int width)>;
+CsvMap parseCsvMap(const char* data, size_t length, const std::string& name, const CsvRowCallback& onRow = nullptr);
+
+// Blendet die Datei per mmap ein und ruft parseCsvMap auf
+CsvMap parseCsvFile(const std::string& filename, const CsvRowCallback& onRow = nullptr);
+
+#endif
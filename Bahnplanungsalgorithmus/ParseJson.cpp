@@ -1,15 +1,16 @@
 #include "ParseJson.h"
+#include <algorithm>
 
 
-ParseJson::ParseJson(string filename, string algorithm, string language) : filename(filename), algorithm(algorithm), language(language), algorithmMap(0, 0) {
+ParseJson::ParseJson(string filename, string algorithm, string language) : filename(filename), algorithm(algorithm), language(language) {
 	parse();
 }
 
 void ParseJson::parse() {
-    // JSON-Datei ffnen
+    // JSON-Datei öffnen
     ifstream file(filename);
     if (!file.is_open()) {
-        cerr << "Fehler beim ffnen der Datei: " << filename << endl;
+        cerr << "Fehler beim Öffnen der Datei: " << filename << endl;
         return;
     }
 
@@ -23,14 +24,51 @@ void ParseJson::parse() {
             this->computingTime = json_data["computing_time"].get<float>();
         }
 
+        if (json_data.contains("computing_time_stats")) {
+            const nlohmann::json& stats = json_data["computing_time_stats"];
+            computingTimeStats.runs = stats.value("runs", 0);
+            computingTimeStats.warmup = stats.value("warmup", 0);
+            computingTimeStats.min = stats.value("min", 0.0);
+            computingTimeStats.median = stats.value("median", 0.0);
+            computingTimeStats.mean = stats.value("mean", 0.0);
+            computingTimeStats.p95 = stats.value("p95", 0.0);
+            computingTimeStats.stddev = stats.value("stddev", 0.0);
+            computingTimeStats.ci95 = stats.value("ci95", 0.0);
+            computingTimeStats.converged = stats.value("converged", false);
+        }
+
         if (json_data.contains("memory_usage")) {
             this->memoryUsage = json_data["memory_usage"].get<float>();
         }
 
+        if (json_data.contains("memory_rss")) {
+            this->memoryRss = json_data["memory_rss"].get<float>();
+        }
+
+        if (json_data.contains("memory_peak_rss")) {
+            this->memoryPeakRss = json_data["memory_peak_rss"].get<float>();
+        }
+
+        if (json_data.contains("memory_allocated")) {
+            this->memoryAllocated = json_data["memory_allocated"].get<long long>();
+        }
+
         if (json_data.contains("path_length")) {
             this->pathLength = json_data["path_length"].get<int>();
         }
 
+        if (json_data.contains("connectivity")) {
+            this->connectivity = json_data["connectivity"].get<int>();
+        }
+
+        if (json_data.contains("cost_scale")) {
+            this->costScale = std::max(1, json_data["cost_scale"].get<int>());
+        }
+
+        if (json_data.contains("expansions")) {
+            this->expansions = json_data["expansions"].get<long long>();
+        }
+
         if (json_data.contains("algorithm_map")) {
             initializeMap(json_data["algorithm_map"]);
         }
@@ -62,13 +100,15 @@ void ParseJson::initializeMap(const nlohmann::json& algorithm_map_json) {
     int map_width = algorithm_map_json[0].size();
     int map_height = algorithm_map_json.size();
 
-    // Map erstellen (mit Rahmen: +2 fr die Grenzen)
-    algorithmMap = Map(map_width, map_height );
+    // Map erstellen (mit Rahmen: +2 für die Grenzen)
+    algorithmMap = Grid<int>(map_width, map_height);
 
-    // Algorithm Map-Daten einlesen und in Map setzen
+    // Algorithm Map-Daten zeilenweise einlesen
     for (int y = 0; y < map_height; ++y) {
+        const nlohmann::json& rowJson = algorithm_map_json[y];
+        int* row = algorithmMap.row(y);
         for (int x = 0; x < map_width; ++x) {
-            algorithmMap.setTile(x , y , algorithm_map_json[y][x]); // +1 fr Rahmen
+            row[x] = rowJson[x].get<int>();
         }
     }
     /*
@@ -88,14 +128,29 @@ void ParseJson::displayData() const {
     cout << "Language: " << language << endl;
     cout << "Algorithm: " << algorithm << endl;
     cout << "Status Code: " << statusCode << endl;
-    cout << "Path Length: " << pathLength << endl;
+    cout << "Path Length: " << getPathLengthInTiles() << " tiles (" << pathLength << " / cost scale " << costScale << ")" << endl;
+    cout << "Connectivity: " << connectivity << endl;
+    if (expansions >= 0) {
+        cout << "Expansions: " << expansions << endl;
+    }
     cout << "Computing Time: " << computingTime << " seconds" << endl;
+    if (hasTimingStats()) {
+        const gridplan::TimingStats& t = computingTimeStats;
+        cout << "Computing Time Runs: " << t.runs << " (Warmup " << t.warmup << ")" << endl;
+        cout << "Computing Time Min/Median/Mean/P95: " << t.min << " / " << t.median << " / " << t.mean << " / " << t.p95 << endl;
+        cout << "Computing Time Stddev: " << t.stddev << ", CI95: +-" << t.ci95 << (t.converged ? "" : " (nicht konvergiert)") << endl;
+    }
     cout << "Memory Usage: " << memoryUsage << " MB" << endl;
+    if (hasMemoryDetails()) {
+        cout << "Memory RSS: " << memoryRss << " MB" << endl;
+        cout << "Memory Peak RSS: " << memoryPeakRss << " MB" << endl;
+        cout << "Memory Allocated: " << memoryAllocated << " bytes" << endl;
+    }
 
     cout << "Algorithm Map:" << endl;
     for (int y = 0; y < algorithmMap.getHeight(); ++y) {
         for (int x = 0; x < algorithmMap.getWidth(); ++x) {
-            cout << algorithmMap.getTile(x, y) << " ";
+            cout << algorithmMap.at(x, y) << " ";
         }
         cout << endl;
     }
@@ -106,7 +161,7 @@ void ParseJson::displayData() const {
     }
 }
 
-const Map& ParseJson::getAlgorithmMap() const {
+const Grid<int>& ParseJson::getAlgorithmMap() const {
     return algorithmMap;
 }
 
@@ -122,10 +177,46 @@ float ParseJson::getComputingTime() const {
     return computingTime;
 }
 
+const gridplan::TimingStats& ParseJson::getComputingTimeStats() const {
+    return computingTimeStats;
+}
+
+bool ParseJson::hasTimingStats() const {
+    return computingTimeStats.runs > 0;
+}
+
 float ParseJson::getMemoryUsage() const {
     return memoryUsage;
 }
 
+float ParseJson::getMemoryRss() const {
+    return memoryRss;
+}
+
+float ParseJson::getMemoryPeakRss() const {
+    return memoryPeakRss;
+}
+
+long long ParseJson::getMemoryAllocated() const {
+    return memoryAllocated;
+}
+
+bool ParseJson::hasMemoryDetails() const {
+    return memoryRss >= 0 || memoryPeakRss >= 0 || memoryAllocated >= 0;
+}
+
+int ParseJson::getConnectivity() const {
+    return connectivity;
+}
+
+int ParseJson::getCostScale() const {
+    return costScale;
+}
+
+float ParseJson::getPathLengthInTiles() const {
+    return static_cast<float>(pathLength) / costScale;
+}
+
 vector<pair<int, int>> ParseJson::getPath() const {
     return path;
 }
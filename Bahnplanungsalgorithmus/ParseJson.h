@@ -4,6 +4,7 @@
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <vector>
+#include "gridplan/Timing.h"
 
 using namespace std;
 
@@ -16,11 +17,19 @@ public:
 	string filename = "none";
 	int statusCode = 0;
 
-	int pathLength = 0;
+	int pathLength = 0;             // in Kosteneinheiten (path_length / costScale = Kacheln)
+	int connectivity = 4;           // 4 oder 8 Nachbarn
+	int costScale = 1;              // Kosten eines geraden Schritts (cost_scale), 1 wenn nicht vorhanden
+	long long expansions = -1;      // expandierte Knoten (nur A*), -1 = nicht vorhanden
 	float computingTime = 0;
+	gridplan::TimingStats computingTimeStats;   // computing_time_stats, runs = 0 wenn nicht vorhanden
 	float memoryUsage = 0;
+	// Speicherkennzahlen der Suche (nur C++-Planer, sonst -1 = nicht gemessen)
+	float memoryRss = -1;           // MB
+	float memoryPeakRss = -1;       // MB
+	long long memoryAllocated = -1; // Bytes
 
-	const Map& getAlgorithmMap() const;
+	const Grid<int>& getAlgorithmMap() const;
 
 	string getAlgorithm() const;
 
@@ -30,15 +39,36 @@ public:
 
 	float getComputingTime() const;
 
+	const gridplan::TimingStats& getComputingTimeStats() const;
+
+	// true, wenn die Laufzeit wiederholt gemessen wurde (computing_time_stats)
+	bool hasTimingStats() const;
+
 	float getMemoryUsage() const;
 
-	Map algorithmMap;
+	float getMemoryRss() const;
+
+	float getMemoryPeakRss() const;
+
+	long long getMemoryAllocated() const;
+
+	// true, wenn die JSON die Felder memory_rss/memory_peak_rss/memory_allocated enthielt
+	bool hasMemoryDetails() const;
+
+	int getConnectivity() const;
+
+	int getCostScale() const;
+
+	// Pfadlaenge in Kacheln (diagonale Schritte zaehlen bei 8er-Nachbarschaft ca. 1,41)
+	float getPathLengthInTiles() const;
+
+	Grid<int> algorithmMap;           // Distanzwerte der Algorithmen
 
 	//vector<vector<int>> algorithm_map;      // 2D-Matrix
 	vector<pair<int, int>> path;   // Liste von Koordinaten
 
 	void displayData() const;
-	// Methode: JSON-Datei parsen und Attribute befllen
+	// Methode: JSON-Datei parsen und Attribute befüllen
 	void parse();
 
 private:
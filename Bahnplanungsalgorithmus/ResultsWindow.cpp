@@ -21,12 +21,12 @@ ResultsWindow::ResultsWindow(Map& originalMap, const std::vector<Algorithm>& alg
     button.setOutlineThickness(2);
     button.setOutlineColor(sf::Color::White);
 
-    // Text fr den Button
+    // Text für den Button
     buttonText.setFillColor(sf::Color::White);
     buttonText.setPosition(map.getWidth() * 5+3, map.getHeight() * 10 + 25); // Zentriert auf dem Button
 }
 
-// Hauptschleife fr das Fenster
+// Hauptschleife für das Fenster
 void ResultsWindow::run() {
     while (window.isOpen()) {
         handleEvents();
@@ -43,7 +43,7 @@ void ResultsWindow::close() {
 
 void ResultsWindow::draw() {
     window.clear(sf::Color(169, 169, 169));
-    int xOffset = map.getWidth() * 10 + 5; // Startposition fr die Darstellung der Karten und Ergebnisse
+    int xOffset = map.getWidth() * 10 + 5; // Startposition für die Darstellung der Karten und Ergebnisse
     if (map.getWidth() < 13) {
         tileSize = 10;
         drawMap(map, 0, 50);
@@ -86,19 +86,42 @@ void ResultsWindow::draw() {
             string language = result->getLanguage();
             float computingTime = result->getComputingTime();
             float memoryUsage = result->getMemoryUsage();
-            int pathLength = result->pathLength;
             mapWidth = result->getAlgorithmMap().getWidth();
             drawPath(map, result->getPath(), xOffset, 50);
             if (mapWidth < 25)
-                drawNumbers(result->getAlgorithmMap(), xOffset, 50);
+                drawNumbers(result->getAlgorithmMap(), xOffset, 50, result->getCostScale());
             string info = language + ": ";
             drawText(info, xOffset, 100 + result->getAlgorithmMap().getHeight() * tileSize + yOffset);
             info = "Computing Time: " + to_string(computingTime) + "ms";
+            if (result->hasTimingStats()) {
+                // Verteilung statt Einzelwert: Median (Min..P95, Standardabweichung, Anzahl Laeufe)
+                const gridplan::TimingStats& t = result->getComputingTimeStats();
+                info = "Computing Time: " + to_string(t.median) + "ms (" + to_string(t.min) + ".." + to_string(t.p95)
+                    + ", sd " + to_string(t.stddev) + ", n=" + to_string(t.runs) + ")";
+            }
             drawText(info, xOffset, 100 + result->getAlgorithmMap().getHeight() * tileSize + yOffset + 20);
             info = "Memory Usage: " + to_string(memoryUsage) + "MB";
             drawText(info, xOffset, 100 + result->getAlgorithmMap().getHeight() * tileSize + yOffset + 40);
-            info = "Path Length: " + to_string(pathLength);
+            // Pfadlaenge in Kacheln; bei Kostenskala (8er-Nachbarschaft) mit Nachkommastellen
+            if (result->getCostScale() == 1) {
+                info = "Path Length: " + to_string(result->pathLength);
+            }
+            else {
+                info = "Path Length: " + to_string(result->getPathLengthInTiles());
+            }
+            if (result->getConnectivity() == 8) {
+                info += " (8-conn.)";
+            }
+            if (result->expansions >= 0) {
+                info += ", Expansions: " + to_string(result->expansions);
+            }
             drawText(info, xOffset, 100 + result->getAlgorithmMap().getHeight() * tileSize + yOffset + 60);
+            if (result->hasMemoryDetails()) {
+                // RSS und Spitzen-RSS in MB, waehrend der Suche angeforderter Heap in KB
+                info = "RSS: " + to_string(result->getMemoryRss()) + "MB, Peak: " + to_string(result->getMemoryPeakRss())
+                    + "MB, Alloc: " + to_string(result->getMemoryAllocated() / 1024) + "KB";
+                drawText(info, xOffset, 100 + result->getAlgorithmMap().getHeight() * tileSize + yOffset + 80);
+            }
 
             yOffset+=100;
         }
@@ -127,12 +150,13 @@ void ResultsWindow::drawPath(const Map& map, const vector<pair<int, int>>& path,
             tile.setPosition(x + col * tileSize, y + row * tileSize);
             tile.setOutlineThickness(1);
             tile.setOutlineColor(sf::Color::Black);
-            // berprfe, ob das aktuelle Tile Teil des Pfades ist
+            // Überprüfe, ob das aktuelle Tile Teil des Pfades ist
             auto it = std::find(path.begin(), path.end(), std::make_pair(row, col));
-            if (map.getTile(col, row) == 2) {
+            Map::Tile value = map.at(col, row);
+            if (value == 2) {
                 tile.setFillColor(sf::Color::Blue); // Start
             }
-            else if (map.getTile(col, row) == 3) {
+            else if (value == 3) {
                 tile.setFillColor(sf::Color::Green); // Ziel
             }
             else if (it != path.end()) {
@@ -141,7 +165,7 @@ void ResultsWindow::drawPath(const Map& map, const vector<pair<int, int>>& path,
             }
             else {
                 // Sonst, je nach Tile-Typ, setze die entsprechende Farbe
-                if (map.getTile(col, row) == 1) {
+                if (value == 1) {
                     tile.setFillColor(sf::Color::Black); // Hindernisse
                 }
                 else {
@@ -153,20 +177,24 @@ void ResultsWindow::drawPath(const Map& map, const vector<pair<int, int>>& path,
     }
 }
 
-void ResultsWindow::drawNumbers(const Map& map, int startX, int startY) {
+void ResultsWindow::drawNumbers(const Grid<int>& algorithmMap, int startX, int startY, int costScale) {
 
 
-    for (int row = 0; row < map.getHeight(); ++row) {
-        for (int col = 0; col < map.getWidth(); ++col) {
+    for (int row = 0; row < algorithmMap.getHeight(); ++row) {
+        for (int col = 0; col < algorithmMap.getWidth(); ++col) {
             sf::RectangleShape tile(sf::Vector2f(tileSize, tileSize));
             tile.setPosition(startX + col * tileSize, startY + row * tileSize);
-            // Erstelle den Text fr die Zahl
+            // Erstelle den Text für die Zahl
             sf::Text text;
             text.setFont(font);
-            text.setString(std::to_string(map.getTile(col, row))); // Zahl aus der Map
-            text.setCharacterSize(15); // Textgre
+            int value = algorithmMap.at(col, row);
+            if (value > 0 && costScale > 1) {
+                value = (value + costScale / 2) / costScale; // Kosteneinheiten in Kacheln
+            }
+            text.setString(std::to_string(value)); // Zahl aus der Map
+            text.setCharacterSize(15); // Textgröße
             text.setFillColor(sf::Color::Black); // Farbe des Texts
-            text.setPosition(startX + col * tileSize + tileSize / 3, startY + row * tileSize + tileSize / 4); // Position im Kstchen
+            text.setPosition(startX + col * tileSize + tileSize / 3, startY + row * tileSize + tileSize / 4); // Position im Kästchen
 
             // Zeichne den Text
             window.draw(text);
@@ -183,13 +211,14 @@ void ResultsWindow::drawMap(const Map& map, int startX, int startY) {
             tile.setOutlineThickness(1);
             tile.setOutlineColor(sf::Color::Black);
 
-            if (map.getTile(col, row) == 1) {
+            Map::Tile value = map.at(col, row);
+            if (value == 1) {
                 tile.setFillColor(sf::Color::Black); // Hindernisse
             }
-            else if (map.getTile(col, row) == 2) {
+            else if (value == 2) {
                 tile.setFillColor(sf::Color::Blue); // Start
             }
-            else if (map.getTile(col, row) == 3) {
+            else if (value == 3) {
                 tile.setFillColor(sf::Color::Green); // Ziel
             }
             else {
@@ -223,7 +252,7 @@ void ResultsWindow::handleEvents() {
         if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
             sf::Vector2i mousePos = sf::Mouse::getPosition(window);
 
-            // Prfe, ob der Button angeklickt wurde
+            // Prüfe, ob der Button angeklickt wurde
             if (button.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                 onButtonClick();
             }
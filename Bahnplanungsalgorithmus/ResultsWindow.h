@@ -20,7 +20,7 @@ private:
     // Handhabung von Ereignissen (z. B. Maus- oder Tastaturaktionen)
     void handleEvents();
 
-    // Zeichnet die Karte und die Benutzeroberflche
+    // Zeichnet die Karte und die Benutzeroberfläche
     void draw();
 
     void close();
@@ -31,10 +31,11 @@ private:
     void drawPath(const Map& map, const vector<pair<int, int>>& path, int x, int y);
 
     //Algorithmen Nummern schreiben
-    void drawNumbers(const Map& map, int startX, int startY);
+    // costScale: Werte werden auf ganze Kacheln gerundet angezeigt (8er-Nachbarschaft bei A*)
+    void drawNumbers(const Grid<int>& algorithmMap, int startX, int startY, int costScale = 1);
 
 
-    // Methode, die bei einem Button-Klick ausgefhrt wird
+    // Methode, die bei einem Button-Klick ausgeführt wird
     void onButtonClick();
 
     void drawText(const std::string& text, int x, int y);
@@ -42,7 +43,7 @@ private:
     // Referenz zur Karte
     Map& map;
 
-    //Vektor fr Algortihmen
+    //Vektor für Algortihmen
     vector<Algorithm> algorithms;
     vector<ParseJson> parsedResults;
     // Neue Datenstrukturen
@@ -54,7 +55,7 @@ private:
     // SFML-Fenster
     sf::RenderWindow window;
 
-    // Schriftart fr den Button-Text
+    // Schriftart für den Button-Text
     sf::Font font;
 
     // Button (Rechteckform)
@@ -63,10 +64,10 @@ private:
     // Button-Text
     sf::Text buttonText;
 
-    // Labels fr die Algorithmen
+    // Labels für die Algorithmen
     sf::Text alg_label[3] = {};
 
-    // Labels fr Programmiersprachen
+    // Labels für Programmiersprachen
     sf::Text lang_label[3] = {};
 
 
@@ -0,0 +1,192 @@
+// Wandelt Karten zwischen CSV und dem binaeren Kartenformat (*.bmap) um, ebenso
+// Gelaendekosten zwischen CSV und *.bcost (CostMap). Binaerdateien werden von
+// Map::loadFromFile bzw. CostMap::loadFromFile ohne Parsen per mmap geladen.
+//
+// Kompilieren (aus dem Ordner Bahnplanungsalgorithmus):
+//   g++ -O2 -std=c++17 -o Tools/MapConverter Tools/MapConverter.cpp Map.cpp CostMap.cpp MappedFile.cpp ParseCsv.cpp
+// Aufruf:
+//   Tools/MapConverter map9.csv map9.bmap [--layout tiled] [--verify]
+//   Tools/MapConverter map9.bmap map9.csv [--verify]
+//   Tools/MapConverter kosten9.csv kosten9.bcost [--layout tiled] [--verify]
+//   Tools/MapConverter kosten9.bcost kosten9.csv
+//   Tools/MapConverter --self-test
+// Die Richtung ergibt sich aus der Endung der Eingabedatei, Kostendateien an der
+// Endung .bcost von Ein- oder Ausgabe. --verify laedt die Ausgabe zurueck und vergleicht
+// kachelweise; --self-test prueft die Rundreise CSV -> *.bmap -> CSV mit allen
+// Kachelwerten 0 bis 255 in beiden Speicheranordnungen (Dateien im aktuellen Ordner).
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../CostMap.h"
+#include "../Map.h"
+
+using namespace std;
+
+bool endsWith(const string& text, const string& suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+void writeCsv(const Map& map, const string& filename) {
+    ofstream file(filename);
+    if (!file.is_open()) {
+        throw runtime_error("Datei konnte nicht geoeffnet werden: " + filename);
+    }
+    vector<Map::Tile> row(map.getWidth());
+    for (int y = 0; y < map.getHeight(); y++) {
+        map.getTiles().copyRow(y, row.data());
+        string line;
+        for (int x = 0; x < map.getWidth(); x++) {
+            if (x > 0) {
+                line += ',';
+            }
+            line += to_string(row[x]);
+        }
+        line += '\n';
+        file << line;
+    }
+}
+
+void writeCostCsv(const CostMap& costs, const string& filename) {
+    ofstream file(filename);
+    if (!file.is_open()) {
+        throw runtime_error("Datei konnte nicht geoeffnet werden: " + filename);
+    }
+    for (int y = 0; y < costs.getHeight(); y++) {
+        string line;
+        for (int x = 0; x < costs.getWidth(); x++) {
+            if (x > 0) {
+                line += ',';
+            }
+            line += to_string(costs.at(x, y));
+        }
+        line += '\n';
+        file << line;
+    }
+}
+
+// Kostendatei umwandeln (CSV <-> *.bcost)
+void convertCosts(const string& input, const string& output, GridLayout layout, bool verify) {
+    if (endsWith(input, ".bcost")) {
+        writeCostCsv(CostMap::loadFromBinary(input, true), output);
+        return;
+    }
+    CostMap costs = CostMap::loadFromCSV(input, layout);
+    costs.saveToBinary(output);
+    if (verify) {
+        CostMap loaded = CostMap::loadFromBinary(output, true);
+        for (int y = 0; y < costs.getHeight(); y++) {
+            for (int x = 0; x < costs.getWidth(); x++) {
+                if (loaded.at(x, y) != costs.at(x, y)) {
+                    throw runtime_error("Abweichung bei (" + to_string(x) + ", " + to_string(y) + ")");
+                }
+            }
+        }
+    }
+    cout << input << " -> " << output << ": " << costs.getWidth() << " x " << costs.getHeight()
+         << ", Kosten " << costs.getMinCost() << " bis " << costs.getMaxCost() << endl;
+}
+
+// Wirft bei der ersten Kachel, die in beiden Karten verschieden ist
+void compareMaps(const Map& expected, const Map& actual) {
+    if (actual.getWidth() != expected.getWidth() || actual.getHeight() != expected.getHeight()) {
+        throw runtime_error("Abweichende Kartengroesse");
+    }
+    for (int y = 0; y < expected.getHeight(); y++) {
+        for (int x = 0; x < expected.getWidth(); x++) {
+            if (actual.at(x, y) != expected.at(x, y) || actual.isObstacle(x, y) != expected.isObstacle(x, y)) {
+                throw runtime_error("Abweichung bei (" + to_string(x) + ", " + to_string(y) + ")");
+            }
+        }
+    }
+}
+
+// Rundreise CSV -> *.bmap -> CSV mit allen Kachelwerten (auch mehrstelligen)
+int selfTest() {
+    const string csvIn = "mapconverter_selftest_in.csv";
+    const string binary = "mapconverter_selftest.bmap";
+    const string csvOut = "mapconverter_selftest_out.csv";
+    Map original(19, 17);
+    for (int i = 0; i < 256; i++) {
+        original.setTile(i % 19, i / 19, i == 2 || i == 3 ? 0 : i);  // ein Start, ein Ziel
+    }
+    original.setTile(4, 15, 2);
+    original.setTile(18, 16, 3);
+    writeCsv(original, csvIn);
+    int status = 0;
+    for (GridLayout layout : { GridLayout::RowMajor, GridLayout::Tiled }) {
+        try {
+            Map parsed = Map::loadFromCSV(csvIn, layout);
+            compareMaps(original, parsed);
+            parsed.saveToBinary(binary);
+            writeCsv(Map::loadFromBinary(binary, true), csvOut);
+            compareMaps(original, Map::loadFromCSV(csvOut));
+            cout << "Rundreise " << (layout == GridLayout::Tiled ? "tiled8x8" : "row-major") << ": OK" << endl;
+        }
+        catch (const exception& e) {
+            cerr << "Fehler: Rundreise " << (layout == GridLayout::Tiled ? "tiled8x8" : "row-major")
+                 << ": " << e.what() << endl;
+            status = 1;
+        }
+    }
+    remove(csvIn.c_str());
+    remove(binary.c_str());
+    remove(csvOut.c_str());
+    return status;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && string(argv[1]) == "--self-test") {
+        return selfTest();
+    }
+    if (argc < 3) {
+        cerr << "Aufruf: MapConverter <eingabe.csv|eingabe.bmap|eingabe.bcost> <ausgabe> [--layout tiled] [--verify]" << endl;
+        cerr << "       MapConverter --self-test" << endl;
+        return 1;
+    }
+    string input = argv[1];
+    string output = argv[2];
+    GridLayout layout = GridLayout::RowMajor;
+    bool verify = false;
+    for (int i = 3; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--layout" && i + 1 < argc && string(argv[i + 1]) == "tiled") {
+            layout = GridLayout::Tiled;
+            i++;
+        }
+        else if (arg == "--verify") {
+            verify = true;
+        }
+    }
+
+    try {
+        if (endsWith(input, ".bcost") || endsWith(output, ".bcost")) {
+            convertCosts(input, output, layout, verify);
+            return 0;
+        }
+        if (endsWith(input, ".bmap")) {
+            Map map = Map::loadFromBinary(input, true);
+            writeCsv(map, output);
+            if (verify) {
+                compareMaps(map, Map::loadFromCSV(output));
+            }
+        }
+        else {
+            Map map = Map::loadFromCSV(input, layout);
+            map.saveToBinary(output);
+            if (verify) {
+                // Zurueckladen und kachelweise vergleichen
+                compareMaps(map, Map::loadFromBinary(output, true));
+            }
+        }
+        BinaryMapHeader header = Map::readBinaryHeader(endsWith(input, ".bmap") ? input : output);
+        cout << input << " -> " << output << ": " << header.width << " x " << header.height
+             << (header.encoding == 1 ? " (tiled8x8)" : " (row-major)") << endl;
+    }
+    catch (const exception& e) {
+        cerr << "Fehler: " << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include "Batch.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+namespace gridplan {
+
+    bool parseQuery(const string& line, Query& query, string& error) {
+        error.clear();
+        string text = line.substr(0, line.find('#'));
+        replace(text.begin(), text.end(), ',', ' ');
+        istringstream fields(text);
+        int values[4];
+        int count = 0;
+        while (count < 4 && fields >> values[count]) {
+            count++;
+        }
+        if (count == 0 && fields.eof()) {
+            return false;  // leere Zeile oder nur Kommentar
+        }
+        string rest;
+        if (count < 4 || (fields >> rest)) {
+            error = "erwartet: startZeile startSpalte zielZeile zielSpalte";
+            return false;
+        }
+        query.startY = values[0];
+        query.startX = values[1];
+        query.goalY = values[2];
+        query.goalX = values[3];
+        return true;
+    }
+
+    BatchPlanner wavefrontPlanner(const Map& map, SearchWorkspace& workspace, int connectivity, bool bidirectional,
+        int threads) {
+        connectivity = normalizeConnectivity(connectivity);
+        threads = bidirectional ? 1 : resolveThreadCount(threads);
+        return [&map, &workspace, connectivity, bidirectional, threads](const Query& q, Grid<int>& visited, SearchStats& stats) {
+            if (bidirectional || threads > 1) {
+                // Diese Varianten legen ihren Arbeitsspeicher ohnehin je Anfrage an; in einer frischen
+                // Matrix sind die erreichten Felder genau die Eintraege ungleich -1
+                Grid<int> reached(map.getWidth(), map.getHeight(), -1, map.getLayout());
+                auto result = bidirectional
+                    ? wavefrontBidirectional(map, q.startX, q.startY, q.goalX, q.goalY, reached, connectivity)
+                    : wavefrontParallel(map, q.startX, q.startY, q.goalX, q.goalY, reached, threads, connectivity);
+                for (size_t cell = 0; cell < reached.size(); cell++) {
+                    stats.expansions += reached.at(cell) != -1 ? 1 : 0;
+                }
+                return result;
+            }
+            auto result = wavefront(map, q.startX, q.startY, q.goalX, q.goalY, visited, connectivity, &workspace);
+            stats.expansions += static_cast<long long>(workspace.touched.size());  // erreichte Felder
+            return result;
+        };
+    }
+
+    BatchPlanner aStarPlanner(const Map& map, SearchWorkspace& workspace, HeuristicKind heuristic, const AStarOptions& options) {
+        AStarOptions aStarOptions = options;
+        aStarOptions.connectivity = normalizeConnectivity(aStarOptions.connectivity);
+        return [&map, &workspace, heuristic, aStarOptions](const Query& q, Grid<int>& visited, SearchStats& stats) {
+            if (aStarOptions.bidirectional) {
+                return aStarBidirectional(map, q.startX, q.startY, q.goalX, q.goalY, visited, heuristic, &stats,
+                    aStarOptions.connectivity);
+            }
+            if (aStarOptions.jumpPoints) {
+                return jumpPointSearch(map, q.startX, q.startY, q.goalX, q.goalY, visited, heuristic, &stats,
+                    aStarOptions.openList, aStarOptions.connectivity);
+            }
+            return aStar(map, q.startX, q.startY, q.goalX, q.goalY, visited, heuristic, &stats, aStarOptions.openList,
+                aStarOptions.connectivity, aStarOptions.costs, &workspace, aStarOptions.landmarks);
+        };
+    }
+
+    BatchPlanner hpaStarPlanner(const HpaStar& hierarchy) {
+        return [&hierarchy](const Query& q, Grid<int>& visited, SearchStats& stats) {
+            return hierarchy.findPath(q.startX, q.startY, q.goalX, q.goalY, visited, &stats);
+        };
+    }
+
+    BatchSummary runBatch(const Map& map, istream& input, ostream& output, const BatchPlanner& planner) {
+        BatchSummary summary;
+        auto batchStart = chrono::high_resolution_clock::now();
+
+        // Eine Arbeitsmatrix fuer alle Anfragen; ihr Inhalt wird nicht ausgewertet
+        Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        auto usable = [&](int x, int y) {
+            return x >= 0 && x < map.getWidth() && y >= 0 && y < map.getHeight() && !map.isObstacle(x, y);
+        };
+
+        string line, error;
+        long long lineNumber = 0;
+        while (getline(input, line)) {
+            lineNumber++;
+            Query query;
+            if (!parseQuery(line, query, error)) {
+                if (!error.empty()) {
+                    cerr << "Fehler in Zeile " << lineNumber << " der Anfragen: " << error << endl;
+                }
+                continue;
+            }
+            summary.queries++;
+
+            int statusCode = 200;
+            int pathLength = -1;
+            double computingTime = 0;
+            SearchStats stats;
+            if (!usable(query.startX, query.startY)) {
+                statusCode = 402;
+            }
+            else if (!usable(query.goalX, query.goalY)) {
+                statusCode = 403;
+            }
+            else if (query.startX == query.goalX && query.startY == query.goalY) {
+                pathLength = 0;  // Start = Ziel: nicht alle Planer erkennen das selbst
+            }
+            else {
+                auto startTime = chrono::high_resolution_clock::now();
+                pathLength = planner(query, visited, stats).first;
+                auto endTime = chrono::high_resolution_clock::now();
+                computingTime = chrono::duration_cast<chrono::nanoseconds>(endTime - startTime).count() / 1000000.0;
+                statusCode = pathLength != -1 ? 200 : 404;
+            }
+            summary.found += statusCode == 200 ? 1 : 0;
+            summary.expansions += stats.expansions;
+            summary.planningTime += computingTime;
+
+            // Start und Ziel als (Zeile, Spalte) wie die Pfade der Ergebnisdateien
+            output << "{\"query\": " << summary.queries
+                << ", \"start\": [" << query.startY << ", " << query.startX << "]"
+                << ", \"goal\": [" << query.goalY << ", " << query.goalX << "]"
+                << ", \"status_code\": " << statusCode
+                << ", \"path_length\": " << pathLength
+                << ", \"computing_time\": " << computingTime
+                << ", \"expansions\": " << stats.expansions << "}\n";
+        }
+
+        auto batchEnd = chrono::high_resolution_clock::now();
+        summary.totalTime = chrono::duration_cast<chrono::nanoseconds>(batchEnd - batchStart).count() / 1000000.0;
+        double queriesPerSecond = summary.totalTime > 0 ? summary.queries * 1000.0 / summary.totalTime : 0;
+        output << "{\"summary\": true, \"queries\": " << summary.queries
+            << ", \"found\": " << summary.found
+            << ", \"expansions\": " << summary.expansions
+            << ", \"planning_time\": " << summary.planningTime
+            << ", \"total_time\": " << summary.totalTime
+            << ", \"queries_per_second\": " << queriesPerSecond << "}" << endl;
+        return summary;
+    }
+
+    bool runBatchFiles(const Map& map, const string& queriesFile, const string& resultFile, const BatchPlanner& planner,
+        BatchSummary& summary) {
+        ifstream queryStream;
+        if (queriesFile != "-") {
+            queryStream.open(queriesFile);
+            if (!queryStream) {
+                cerr << "Fehler: Anfragedatei " << queriesFile << " konnte nicht geoeffnet werden." << endl;
+                return false;
+            }
+        }
+        ofstream resultStream;
+        if (resultFile != "-") {
+            resultStream.open(resultFile);
+            if (!resultStream) {
+                cerr << "Fehler: Ergebnisdatei " << resultFile << " konnte nicht geoeffnet werden." << endl;
+                return false;
+            }
+        }
+        summary = runBatch(map, queriesFile == "-" ? cin : queryStream, resultFile == "-" ? cout : resultStream, planner);
+        return true;
+    }
+
+}
@@ -0,0 +1,72 @@
+#ifndef GRIDPLAN_BATCH_H
+#define GRIDPLAN_BATCH_H
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Grid.h"
+#include "../Map.h"
+#include "HpaStar.h"
+#include "OpenList.h"
+#include "Planners.h"
+#include "SearchWorkspace.h"
+
+// Stapelbetrieb: viele Anfragen (Start/Ziel-Paare) auf einer einmal geladenen Karte. Die
+// Kacheln 2 und 3 der Karte spielen dabei keine Rolle.
+namespace gridplan {
+
+    // Eine Anfrage, Start und Ziel als (x, y) = (Spalte, Zeile) wie Map::getStart
+    struct Query {
+        int startX = 0, startY = 0;
+        int goalX = 0, goalY = 0;
+    };
+
+    // Liest eine Zeile der Anfragedatei: "startZeile startSpalte zielZeile zielSpalte", getrennt
+    // durch Leerzeichen oder Kommas (Reihenfolge wie die Pfade in der JSON). Leere Zeilen und
+    // Kommentare (#) ergeben false ohne Fehlermeldung, fehlerhafte Zeilen false mit error.
+    bool parseQuery(const std::string& line, Query& query, std::string& error);
+
+    // Plant eine Anfrage: Pfadlaenge (-1 = nicht erreichbar) und Pfad. visited ist eine
+    // Arbeitsmatrix der Kartengroesse, deren Inhalt im Stapelbetrieb nicht ausgewertet wird.
+    using BatchPlanner = std::function<std::pair<int, std::vector<std::pair<int, int>>>(const Query& query,
+        Grid<int>& visited, SearchStats& stats)>;
+
+    // Planer wie in den Programmen. Wavefront, A* und Dijkstra arbeiten in workspace, das ueber
+    // alle Anfragen wiederverwendet wird (ausser den bidirektionalen und parallelen Varianten
+    // und JPS, die ihren Arbeitsspeicher selbst anlegen); HPA* verwendet seine Abstraktion,
+    // A* mit HeuristicKind::Landmarks die Tabellen options.landmarks.
+    // map, workspace, hierarchy und die Landmarken muessen so lange bestehen bleiben wie der Planer.
+    BatchPlanner wavefrontPlanner(const Map& map, SearchWorkspace& workspace, int connectivity = 4,
+        bool bidirectional = false, int threads = 1);
+    BatchPlanner aStarPlanner(const Map& map, SearchWorkspace& workspace, HeuristicKind heuristic,
+        const AStarOptions& options = AStarOptions());
+    BatchPlanner hpaStarPlanner(const HpaStar& hierarchy);
+
+    // Zusammenfassung eines Stapellaufs
+    struct BatchSummary {
+        long long queries = 0;          // gelesene Anfragen (ohne leere Zeilen, Kommentare, Fehler)
+        long long found = 0;            // davon mit Weg (Status 200)
+        long long expansions = 0;       // Summe ueber alle Anfragen
+        double planningTime = 0;        // Summe der Suchzeiten in Millisekunden
+        double totalTime = 0;           // gesamter Lauf mit Lesen und Schreiben in Millisekunden
+    };
+
+    // Liest die Anfragen zeilenweise aus input, plant jede mit planner und schreibt gleich danach
+    // eine JSON-Zeile je Anfrage nach output (query, start, goal, status_code, path_length,
+    // computing_time, expansions), am Ende eine Zeile mit der Zusammenfassung und queries_per_second.
+    // Start oder Ziel ausserhalb der Karte bzw. auf einem Hindernis ergibt Status 402 bzw. 403,
+    // Start = Ziel ohne Aufruf des Planers Status 200 mit path_length 0.
+    // Fehlerhafte Zeilen werden mit Zeilennummer nach std::cerr gemeldet und uebersprungen.
+    BatchSummary runBatch(const Map& map, std::istream& input, std::ostream& output, const BatchPlanner& planner);
+
+    // runBatch mit input = Datei queriesFile ("-" = Standardeingabe) und output = Datei
+    // resultFile ("-" = Standardausgabe). Rueckgabe false, wenn eine Datei nicht geoeffnet
+    // werden kann (Meldung nach std::cerr).
+    bool runBatchFiles(const Map& map, const std::string& queriesFile, const std::string& resultFile,
+        const BatchPlanner& planner, BatchSummary& summary);
+
+}
+
+#endif
@@ -0,0 +1,324 @@
+#include "Planners.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+using namespace std;
+
+// Bidirektionale Suche mit zwei Threads: einer sucht vom Start, einer vom Ziel aus.
+//
+// Jede Seite schreibt nur ihre eigene Entfernungsmatrix; die Matrix der Gegenseite wird
+// nur gelesen. Treffen erkennt die Seite, die ein Feld als zweite erreicht: sie schreibt
+// ihre Entfernung und liest danach die der Gegenseite (beides seq_cst, so dass von zwei
+// gleichzeitigen Zugriffen mindestens einer den anderen sieht). Das beste Treffen
+// (Kosten in den oberen, Feld in den unteren 32 Bit) wird per compare_exchange minimiert,
+// Sperren gibt es keine.
+namespace gridplan {
+
+    namespace {
+
+        const uint64_t NO_MEETING = UINT64_MAX;
+
+        // Entfernungsmatrix einer Seite, -1 bzw. INT_MAX = nicht erreicht
+        using DistanceArray = unique_ptr<atomic<int>[]>;
+
+        DistanceArray makeDistances(size_t count, int value) {
+            DistanceArray distances(new atomic<int>[count]);
+            for (size_t i = 0; i < count; i++) {
+                distances[i].store(value, memory_order_relaxed);
+            }
+            return distances;
+        }
+
+        // Gemeinsamer Zustand beider Threads
+        struct Meeting {
+            atomic<uint64_t> best{ NO_MEETING };
+            atomic<bool> stop{ false };
+
+            void offer(int cost, size_t node) {
+                uint64_t candidate = (static_cast<uint64_t>(cost) << 32) | static_cast<uint32_t>(node);
+                uint64_t current = best.load(memory_order_relaxed);
+                while (candidate < current && !best.compare_exchange_weak(current, candidate)) {
+                }
+            }
+            long long bestCost() const {
+                uint64_t value = best.load();
+                return value == NO_MEETING ? LLONG_MAX : static_cast<long long>(value >> 32);
+            }
+            size_t bestNode() const { return static_cast<size_t>(best.load() & 0xFFFFFFFFu); }
+        };
+
+        // Weg vom Treffpunkt zum Ursprung einer Seite ueber abnehmende Entfernungen
+        template <typename Neighbourhood>
+        void walkDown(const Map& map, const DistanceArray& distance, size_t node, vector<pair<int, int>>& out) {
+            int x = map.indexToX(node), y = map.indexToY(node);
+            while (distance[map.index(x, y)].load(memory_order_relaxed) > 0) {
+                int d = distance[map.index(x, y)].load(memory_order_relaxed);
+                unsigned freeMask = Neighbourhood::moves(map, x, y);
+                for (int k = 0; k < Neighbourhood::count; k++) {
+                    if (!(freeMask & (1u << k))) {
+                        continue;
+                    }
+                    int nx = x + Neighbourhood::dx[k], ny = y + Neighbourhood::dy[k];
+                    if (distance[map.index(nx, ny)].load(memory_order_relaxed) == d - 1) {
+                        x = nx;
+                        y = ny;
+                        break;
+                    }
+                }
+                out.push_back({ y, x });
+            }
+        }
+
+        // Weg ueber Elternzeiger bis zum Ursprung (ohne Ausgangsfeld)
+        void walkParents(const Map& map, const vector<uint32_t>& parent, size_t node, size_t origin,
+            vector<pair<int, int>>& out) {
+            while (node != origin) {
+                node = parent[node];
+                out.push_back({ map.indexToY(node), map.indexToX(node) });
+            }
+        }
+
+        // Pfad (Zeile, Spalte) vom Start ueber den Treffpunkt zum Ziel
+        template <typename WalkForward, typename WalkBackward>
+        vector<pair<int, int>> joinPath(const Map& map, size_t meet, WalkForward forward, WalkBackward backward) {
+            vector<pair<int, int>> path;
+            forward(path);
+            reverse(path.begin(), path.end());
+            path.push_back({ map.indexToY(meet), map.indexToX(meet) });
+            backward(path);
+            return path;
+        }
+
+        // Beide Entfernungsmatrizen zu visited zusammenfuehren: Felder der Vorwaertssuche
+        // erhalten die Entfernung zum Start, nur rueckwaerts erreichte die zum Ziel
+        void mergeVisited(const DistanceArray& forward, const DistanceArray& backward, int unreached, Grid<int>& visited) {
+            for (size_t i = 0; i < visited.size(); i++) {
+                int f = forward[i].load(memory_order_relaxed);
+                int b = backward[i].load(memory_order_relaxed);
+                visited.at(i) = f != unreached ? f : (b != unreached ? b : -1);
+            }
+        }
+
+        // Eine Seite der bidirektionalen Breitensuche, ebenenweise. level = Anzahl vollstaendig
+        // entdeckter Ebenen; sobald levelVorwaerts + levelRueckwaerts >= bestes Treffen, liegt
+        // jeder kuerzere Weg vollstaendig in beiden Suchen und waere schon gefunden.
+        template <typename Neighbourhood>
+        void bfsSide(const Map& map, size_t origin, DistanceArray& own, const DistanceArray& other,
+            atomic<int>& ownLevel, const atomic<int>& otherLevel, Meeting& meeting) {
+            const int EXHAUSTED = INT_MAX / 4;
+            vector<size_t> frontier = { origin }, next;
+            int level = 0;
+            while (!meeting.stop.load(memory_order_relaxed)) {
+                next.clear();
+                for (size_t current : frontier) {
+                    int x = map.indexToX(current), y = map.indexToY(current);
+                    unsigned freeMask = Neighbourhood::moves(map, x, y);
+                    for (int d = 0; d < Neighbourhood::count; d++) {
+                        if (!(freeMask & (1u << d))) {
+                            continue;
+                        }
+                        size_t n = map.index(x + Neighbourhood::dx[d], y + Neighbourhood::dy[d]);
+                        if (own[n].load(memory_order_relaxed) != -1) {
+                            continue;
+                        }
+                        own[n].store(level + 1);
+                        int otherDistance = other[n].load();
+                        if (otherDistance != -1) {
+                            meeting.offer(level + 1 + otherDistance, n);
+                        }
+                        next.push_back(n);
+                    }
+                }
+                frontier.swap(next);
+                level++;
+                if (frontier.empty()) {
+                    // Zusammenhangskomponente vollstaendig durchsucht: ohne Treffen unerreichbar
+                    ownLevel.store(EXHAUSTED);
+                    if (meeting.bestCost() == LLONG_MAX) {
+                        meeting.stop.store(true);
+                    }
+                }
+                else {
+                    ownLevel.store(level);
+                }
+                if (static_cast<long long>(ownLevel.load()) + otherLevel.load() >= meeting.bestCost()) {
+                    meeting.stop.store(true);
+                }
+                if (frontier.empty()) {
+                    break;
+                }
+            }
+        }
+
+        // Eine Seite des bidirektionalen A* mit gemittelten Potentialen: mit hZiel und hStart
+        // ist der Schluessel vorwaerts 2g + hZiel - hStart, rueckwaerts 2g + hStart - hZiel
+        // (plus offset, damit er nicht negativ wird). Beide Seiten laufen so als Dijkstra auf
+        // demselben Graphen mit reduzierten, nichtnegativen Kosten, und es darf wie bei der
+        // bidirektionalen Dijkstra-Suche abgebrochen werden, sobald die Summe der kleinsten
+        // Schluessel beider Seiten das Doppelte des besten Treffens erreicht. Die Gegenseite
+        // veroeffentlicht ihren kleinsten Schluessel in otherTop; ein veralteter Wert ist
+        // hoechstens kleiner und damit nur vorsichtiger.
+        template <typename Heuristic, typename Neighbourhood>
+        void aStarSide(const Map& map, size_t origin, int targetX, int targetY, int originX, int originY,
+            int offset, DistanceArray& own, const DistanceArray& other, vector<uint32_t>& parent,
+            atomic<int>& ownTop, const atomic<int>& otherTop, Meeting& meeting, SearchStats& counters) {
+            const Heuristic toTarget{ targetX, targetY };
+            const Heuristic toOrigin{ originX, originY };
+            auto potential = [&](int x, int y) {
+                return toTarget(x, y) - toOrigin(x, y) + offset;
+                };
+
+            DaryHeap<4> openSet(map.size());
+            openSet.pushOrDecrease(static_cast<uint32_t>(origin), potential(originX, originY),
+                toTarget(originX, originY), counters);
+
+            const int EXHAUSTED = INT_MAX / 4;
+            while (!meeting.stop.load(memory_order_relaxed)) {
+                if (openSet.empty()) {
+                    ownTop.store(EXHAUSTED);
+                    meeting.stop.store(true);  // Komponente erschoepft (mit oder ohne Treffen)
+                    break;
+                }
+                ownTop.store(openSet.minF());
+                long long keys = static_cast<long long>(openSet.minF()) + otherTop.load() - 2LL * offset;
+                long long best = meeting.bestCost();
+                if (best != LLONG_MAX && keys >= 2 * best) {
+                    meeting.stop.store(true);
+                    break;
+                }
+                size_t current = openSet.popMin();
+                counters.expansions++;
+                int x = map.indexToX(current), y = map.indexToY(current);
+                int g = own[current].load(memory_order_relaxed);
+                unsigned freeMask = Neighbourhood::moves(map, x, y);
+                for (int d = 0; d < Neighbourhood::count; d++) {
+                    if (!(freeMask & (1u << d))) {
+                        continue;
+                    }
+                    int nx = x + Neighbourhood::dx[d], ny = y + Neighbourhood::dy[d];
+                    size_t n = map.index(nx, ny);
+                    if (openSet.isClosed(static_cast<uint32_t>(n))) {
+                        continue;
+                    }
+                    int tentative = g + Neighbourhood::cost[d];
+                    if (tentative < own[n].load(memory_order_relaxed)) {
+                        own[n].store(tentative);
+                        parent[n] = static_cast<uint32_t>(current);
+                        int otherDistance = other[n].load();
+                        if (otherDistance != INT_MAX) {
+                            meeting.offer(tentative + otherDistance, n);
+                        }
+                        openSet.pushOrDecrease(static_cast<uint32_t>(n), 2 * tentative + potential(nx, ny),
+                            toTarget(nx, ny), counters);
+                    }
+                }
+            }
+        }
+
+    }
+
+    template <typename Neighbourhood>
+    static pair<int, vector<pair<int, int>>> wavefrontBidirectionalWith(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited) {
+        size_t start = map.index(startX, startY);
+        size_t goal = map.index(goalX, goalY);
+
+        DistanceArray forward = makeDistances(map.size(), -1);
+        DistanceArray backward = makeDistances(map.size(), -1);
+        forward[start].store(0);
+        backward[goal].store(0);
+        atomic<int> forwardLevel{ 0 }, backwardLevel{ 0 };
+        Meeting meeting;
+
+        thread backwardThread(bfsSide<Neighbourhood>, cref(map), goal, ref(backward), cref(forward),
+            ref(backwardLevel), cref(forwardLevel), ref(meeting));
+        bfsSide<Neighbourhood>(map, start, forward, backward, forwardLevel, backwardLevel, meeting);
+        backwardThread.join();
+
+        mergeVisited(forward, backward, -1, visited);
+        if (meeting.bestCost() == LLONG_MAX) {
+            return { -1, {} };
+        }
+        size_t meet = meeting.bestNode();
+        vector<pair<int, int>> path = joinPath(map, meet,
+            [&](vector<pair<int, int>>& out) { walkDown<Neighbourhood>(map, forward, meet, out); },
+            [&](vector<pair<int, int>>& out) { walkDown<Neighbourhood>(map, backward, meet, out); });
+        return { static_cast<int>(meeting.bestCost()), path };
+    }
+
+    pair<int, vector<pair<int, int>>> wavefrontBidirectional(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, int connectivity) {
+        if (connectivity == 8) {
+            return wavefrontBidirectionalWith<EightConnected>(map, startX, startY, goalX, goalY, visited);
+        }
+        return wavefrontBidirectionalWith<FourConnected>(map, startX, startY, goalX, goalY, visited);
+    }
+
+    template <typename Heuristic, typename Neighbourhood>
+    static pair<int, vector<pair<int, int>>> aStarBidirectionalWith(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, SearchStats* stats) {
+        size_t start = map.index(startX, startY);
+        size_t goal = map.index(goalX, goalY);
+
+        DistanceArray forward = makeDistances(map.size(), INT_MAX);
+        DistanceArray backward = makeDistances(map.size(), INT_MAX);
+        forward[start].store(0);
+        backward[goal].store(0);
+        vector<uint32_t> forwardParent(map.size()), backwardParent(map.size());
+        SearchStats forwardStats, backwardStats;
+        Meeting meeting;
+
+        // Startschluessel beider Seiten vorab veroeffentlichen (Potential am Ursprung, g = 0)
+        int offset = Neighbourhood::straightCost * (map.getWidth() + map.getHeight());
+        int startGoal = Heuristic{ goalX, goalY }(startX, startY);
+        atomic<int> forwardTop{ startGoal + offset }, backwardTop{ startGoal + offset };
+
+        thread backwardThread(aStarSide<Heuristic, Neighbourhood>, cref(map), goal, startX, startY, goalX, goalY, offset,
+            ref(backward), cref(forward), ref(backwardParent), ref(backwardTop), cref(forwardTop),
+            ref(meeting), ref(backwardStats));
+        aStarSide<Heuristic, Neighbourhood>(map, start, goalX, goalY, startX, startY, offset, forward, backward, forwardParent,
+            forwardTop, backwardTop, meeting, forwardStats);
+        backwardThread.join();
+
+        if (stats != nullptr) {
+            stats->expansions += forwardStats.expansions + backwardStats.expansions;
+            stats->pushes += forwardStats.pushes + backwardStats.pushes;
+            stats->decreaseKeys += forwardStats.decreaseKeys + backwardStats.decreaseKeys;
+        }
+        mergeVisited(forward, backward, INT_MAX, visited);
+        if (meeting.bestCost() == LLONG_MAX) {
+            return { -1, {} };
+        }
+        size_t meet = meeting.bestNode();
+        vector<pair<int, int>> path = joinPath(map, meet,
+            [&](vector<pair<int, int>>& out) { walkParents(map, forwardParent, meet, start, out); },
+            [&](vector<pair<int, int>>& out) { walkParents(map, backwardParent, meet, goal, out); });
+        return { static_cast<int>(meeting.bestCost()), path };
+    }
+
+    template <typename Neighbourhood>
+    static pair<int, vector<pair<int, int>>> aStarBidirectionalWithHeuristic(const Map& map, int startX, int startY,
+        int goalX, int goalY, Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats) {
+        if (heuristic == HeuristicKind::Airplane) {
+            return aStarBidirectionalWith<AirplaneHeuristic<Neighbourhood>, Neighbourhood>(map, startX, startY, goalX, goalY, visited, stats);
+        }
+        if (heuristic == HeuristicKind::Octile) {
+            return aStarBidirectionalWith<OctileHeuristic<Neighbourhood>, Neighbourhood>(map, startX, startY, goalX, goalY, visited, stats);
+        }
+        return aStarBidirectionalWith<ManhattanHeuristic<Neighbourhood>, Neighbourhood>(map, startX, startY, goalX, goalY, visited, stats);
+    }
+
+    pair<int, vector<pair<int, int>>> aStarBidirectional(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats, int connectivity) {
+        if (connectivity == 8) {
+            return aStarBidirectionalWithHeuristic<EightConnected>(map, startX, startY, goalX, goalY, visited, heuristic, stats);
+        }
+        return aStarBidirectionalWithHeuristic<FourConnected>(map, startX, startY, goalX, goalY, visited, heuristic, stats);
+    }
+
+}
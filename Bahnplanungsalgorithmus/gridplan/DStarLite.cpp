@@ -0,0 +1,352 @@
+#include "DStarLite.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include "../BitOps.h"
+#include "../Grid.h"
+#include "SearchPolicies.h"
+
+using namespace std;
+
+// D* Lite in der optimierten Fassung (Koenig/Likhachev 2002, Abb. 4). Gesucht wird vom Ziel
+// zum Start: g(s) ist die Entfernung zum Ziel, rhs(s) = min ueber die Nachbarn s' von
+// c(s, s') + g(s'). Knoten mit g != rhs sind inkonsistent und liegen in der offenen Liste mit
+// dem Schluessel [min(g, rhs) + h(Start, s) + km; min(g, rhs)].
+// - Ein verschobener Start erhoeht km um h(alter Start, neuer Start), die Schluessel in der
+//   Liste bleiben so untere Schranken und werden erst beim Entnehmen aktualisiert.
+// - Eine geaenderte Kachel veraendert die Zuege von und zu ihr und (8er, ohne Eckenschneiden)
+//   die Diagonalen an ihr vorbei. Alle betroffenen Zuege beginnen im 3x3-Feld um die Kachel,
+//   dort wird rhs neu berechnet; danach repariert computeShortestPath nur die inkonsistenten
+//   Knoten.
+// Die Zuege sind symmetrisch (Map::freeNeighbours/freeNeighbours8), Vorgaenger und Nachfolger
+// sind also dieselben Nachbarn.
+namespace gridplan {
+
+    // Schnittstelle der Suchinstanzen (eine pro Nachbarschaft)
+    class IncrementalSearch {
+    public:
+        virtual ~IncrementalSearch() = default;
+        virtual IncrementalResult plan(int startX, int startY, int goalX, int goalY) = 0;
+        virtual IncrementalResult replan(int startX, int startY, const vector<pair<int, int>>& changedCells) = 0;
+    };
+
+    namespace {
+
+        const int INF = INT_MAX / 4;
+
+        // Indizierte binaere Min-Halde mit 64-Bit-Schluesseln (k1 << 32 | k2). Anders als die
+        // offenen Listen von A* muessen Schluessel steigen und Knoten entfernt werden koennen.
+        class KeyedHeap {
+        public:
+            explicit KeyedHeap(size_t nodeCount) : position(nodeCount, -1) {}
+
+            bool empty() const { return heap.empty(); }
+            bool contains(uint32_t node) const { return position[node] >= 0; }
+            uint64_t topKey() const { return heap.empty() ? UINT64_MAX : heap.front().key; }
+            uint32_t top() const { return heap.front().node; }
+
+            // Einfuegen oder Schluessel aendern
+            void set(uint32_t node, uint64_t key) {
+                int32_t pos = position[node];
+                if (pos < 0) {
+                    pos = static_cast<int32_t>(heap.size());
+                    heap.push_back({ key, node });
+                    position[node] = pos;
+                    siftUp(pos);
+                    return;
+                }
+                uint64_t old = heap[pos].key;
+                heap[pos].key = key;
+                if (key < old) {
+                    siftUp(pos);
+                }
+                else {
+                    siftDown(pos);
+                }
+            }
+
+            void remove(uint32_t node) {
+                int32_t pos = position[node];
+                if (pos < 0) {
+                    return;
+                }
+                position[node] = -1;
+                Entry last = heap.back();
+                heap.pop_back();
+                if (pos < static_cast<int32_t>(heap.size())) {
+                    uint64_t old = heap[pos].key;
+                    heap[pos] = last;
+                    position[last.node] = pos;
+                    if (last.key < old) {
+                        siftUp(pos);
+                    }
+                    else {
+                        siftDown(pos);
+                    }
+                }
+            }
+
+            void clear() {
+                for (const Entry& entry : heap) {
+                    position[entry.node] = -1;
+                }
+                heap.clear();
+            }
+
+        private:
+            struct Entry {
+                uint64_t key;
+                uint32_t node;
+            };
+
+            void siftUp(int32_t pos) {
+                Entry entry = heap[pos];
+                while (pos > 0) {
+                    int32_t parent = (pos - 1) / 2;
+                    if (heap[parent].key <= entry.key) {
+                        break;
+                    }
+                    heap[pos] = heap[parent];
+                    position[heap[pos].node] = pos;
+                    pos = parent;
+                }
+                heap[pos] = entry;
+                position[entry.node] = pos;
+            }
+
+            void siftDown(int32_t pos) {
+                Entry entry = heap[pos];
+                int32_t size = static_cast<int32_t>(heap.size());
+                while (true) {
+                    int32_t child = 2 * pos + 1;
+                    if (child >= size) {
+                        break;
+                    }
+                    if (child + 1 < size && heap[child + 1].key < heap[child].key) {
+                        child++;
+                    }
+                    if (heap[child].key >= entry.key) {
+                        break;
+                    }
+                    heap[pos] = heap[child];
+                    position[heap[pos].node] = pos;
+                    pos = child;
+                }
+                heap[pos] = entry;
+                position[entry.node] = pos;
+            }
+
+            vector<Entry> heap;
+            vector<int32_t> position;
+        };
+
+        template <typename Neighbourhood>
+        class DStarLiteSearch : public IncrementalSearch {
+        public:
+            explicit DStarLiteSearch(const Map& map)
+                : map(map), g(map.getWidth(), map.getHeight(), INF, map.getLayout()),
+                  rhs(map.getWidth(), map.getHeight(), INF, map.getLayout()), open(g.size()) {}
+
+            IncrementalResult plan(int startX, int startY, int goalX, int goalY) override {
+                IncrementalResult result;
+                if (!initialized || goalX != this->goalX || goalY != this->goalY) {
+                    reset(startX, startY, goalX, goalY);
+                    result.fullSearch = true;
+                }
+                else {
+                    moveStart(startX, startY);
+                }
+                finish(result);
+                return result;
+            }
+
+            IncrementalResult replan(int startX, int startY, const vector<pair<int, int>>& changedCells) override {
+                IncrementalResult result;
+                if (!initialized) {
+                    return result;
+                }
+                moveStart(startX, startY);
+                int width = map.getWidth(), height = map.getHeight();
+                for (const auto& cell : changedCells) {
+                    for (int y = max(0, cell.second - 1); y <= min(height - 1, cell.second + 1); y++) {
+                        for (int x = max(0, cell.first - 1); x <= min(width - 1, cell.first + 1); x++) {
+                            if (!(x == goalX && y == goalY)) {
+                                rhs.at(x, y) = bestSuccessor(x, y);
+                                updateVertex(x, y);
+                            }
+                        }
+                    }
+                }
+                finish(result);
+                return result;
+            }
+
+        private:
+            void reset(int startX, int startY, int goalX, int goalY) {
+                g.fill(INF);
+                rhs.fill(INF);
+                open.clear();
+                km = 0;
+                this->startX = startX;
+                this->startY = startY;
+                this->goalX = goalX;
+                this->goalY = goalY;
+                initialized = true;
+                rhs.at(goalX, goalY) = 0;
+                open.set(static_cast<uint32_t>(map.index(goalX, goalY)), key(goalX, goalY));
+            }
+
+            void moveStart(int x, int y) {
+                km += OctileHeuristic<Neighbourhood>{ startX, startY }(x, y);
+                startX = x;
+                startY = y;
+            }
+
+            void finish(IncrementalResult& result) {
+                result.expansions = computeShortestPath();
+                extractPath(result);
+            }
+
+            uint64_t key(int x, int y) const {
+                int64_t m = min(g.at(x, y), rhs.at(x, y));
+                int64_t k1 = min<int64_t>(m + OctileHeuristic<Neighbourhood>{ startX, startY }(x, y) + km, UINT32_MAX);
+                return (static_cast<uint64_t>(k1) << 32) | static_cast<uint32_t>(m);
+            }
+
+            // min ueber die freien Nachbarn von c(s, s') + g(s'); Hindernisse haben rhs = INF
+            int bestSuccessor(int x, int y) const {
+                if (map.isObstacle(x, y)) {
+                    return INF;
+                }
+                int best = INF;
+                for (unsigned freeMask = Neighbourhood::moves(map, x, y); freeMask != 0; freeMask &= freeMask - 1) {
+                    int d = countTrailingZeros(freeMask);
+                    int next = g.at(x + Neighbourhood::dx[d], y + Neighbourhood::dy[d]);
+                    if (next < INF) {
+                        best = min(best, next + Neighbourhood::cost[d]);
+                    }
+                }
+                return best;
+            }
+
+            void updateVertex(int x, int y) {
+                uint32_t node = static_cast<uint32_t>(map.index(x, y));
+                if (g.at(x, y) != rhs.at(x, y)) {
+                    open.set(node, key(x, y));
+                }
+                else {
+                    open.remove(node);
+                }
+            }
+
+            long long computeShortestPath() {
+                long long expansions = 0;
+                while (open.topKey() < key(startX, startY) || rhs.at(startX, startY) > g.at(startX, startY)) {
+                    uint32_t node = open.top();
+                    int x = map.indexToX(node), y = map.indexToY(node);
+                    uint64_t oldKey = open.topKey();
+                    uint64_t newKey = key(x, y);
+                    if (oldKey < newKey) {
+                        open.set(node, newKey);  // veralteter Schluessel nach verschobenem Start
+                        continue;
+                    }
+                    expansions++;
+                    unsigned freeMask = Neighbourhood::moves(map, x, y);
+                    if (g.at(x, y) > rhs.at(x, y)) {
+                        // Ueberkonsistent: g absenken, Nachbarn koennen guenstiger werden
+                        int value = rhs.at(x, y);
+                        g.at(x, y) = value;
+                        open.remove(node);
+                        for (; freeMask != 0; freeMask &= freeMask - 1) {
+                            int d = countTrailingZeros(freeMask);
+                            int px = x + Neighbourhood::dx[d], py = y + Neighbourhood::dy[d];
+                            if (!(px == goalX && py == goalY) && value + Neighbourhood::cost[d] < rhs.at(px, py)) {
+                                rhs.at(px, py) = value + Neighbourhood::cost[d];
+                                updateVertex(px, py);
+                            }
+                        }
+                    }
+                    else {
+                        // Unterkonsistent: g verwerfen, alle Nachbarn, die ueber diesen Knoten
+                        // liefen, und der Knoten selbst suchen einen neuen Nachfolger
+                        int old = g.at(x, y);
+                        g.at(x, y) = INF;
+                        for (; freeMask != 0; freeMask &= freeMask - 1) {
+                            int d = countTrailingZeros(freeMask);
+                            int px = x + Neighbourhood::dx[d], py = y + Neighbourhood::dy[d];
+                            if (!(px == goalX && py == goalY) && rhs.at(px, py) == old + Neighbourhood::cost[d]) {
+                                rhs.at(px, py) = bestSuccessor(px, py);
+                            }
+                            updateVertex(px, py);
+                        }
+                        if (!(x == goalX && y == goalY)) {
+                            rhs.at(x, y) = bestSuccessor(x, y);
+                        }
+                        updateVertex(x, y);
+                    }
+                }
+                return expansions;
+            }
+
+            // Vom Start jeweils zum Nachbarn mit kleinstem c + g bis zum Ziel
+            void extractPath(IncrementalResult& result) const {
+                int length = rhs.at(startX, startY);
+                if (length >= INF || map.isObstacle(startX, startY) || map.isObstacle(goalX, goalY)) {
+                    return;
+                }
+                result.pathLength = length;
+                int x = startX, y = startY;
+                result.path.push_back({ y, x });
+                size_t limit = static_cast<size_t>(map.getWidth()) * map.getHeight();
+                while (!(x == goalX && y == goalY) && result.path.size() <= limit) {
+                    int best = INF, bestX = x, bestY = y;
+                    for (unsigned freeMask = Neighbourhood::moves(map, x, y); freeMask != 0; freeMask &= freeMask - 1) {
+                        int d = countTrailingZeros(freeMask);
+                        int nx = x + Neighbourhood::dx[d], ny = y + Neighbourhood::dy[d];
+                        int next = g.at(nx, ny);
+                        if (next < INF && next + Neighbourhood::cost[d] < best) {
+                            best = next + Neighbourhood::cost[d];
+                            bestX = nx;
+                            bestY = ny;
+                        }
+                    }
+                    if (best >= INF) {
+                        result.pathLength = -1;
+                        result.path.clear();
+                        return;
+                    }
+                    x = bestX;
+                    y = bestY;
+                    result.path.push_back({ y, x });
+                }
+            }
+
+            const Map& map;
+            Grid<int> g, rhs;
+            KeyedHeap open;
+            int km = 0;
+            int startX = 0, startY = 0, goalX = 0, goalY = 0;
+            bool initialized = false;
+        };
+    }
+
+    DStarLite::DStarLite(const Map& map, int connectivity) : connectivity(normalizeConnectivity(connectivity)) {
+        if (this->connectivity == 8) {
+            search.reset(new DStarLiteSearch<EightConnected>(map));
+        }
+        else {
+            search.reset(new DStarLiteSearch<FourConnected>(map));
+        }
+    }
+
+    DStarLite::~DStarLite() = default;
+
+    IncrementalResult DStarLite::plan(int startX, int startY, int goalX, int goalY) {
+        return search->plan(startX, startY, goalX, goalY);
+    }
+
+    IncrementalResult DStarLite::replan(int startX, int startY, const vector<pair<int, int>>& changedCells) {
+        return search->replan(startX, startY, changedCells);
+    }
+
+}
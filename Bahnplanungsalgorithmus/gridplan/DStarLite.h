@@ -0,0 +1,50 @@
+#ifndef GRIDPLAN_DSTARLITE_H
+#define GRIDPLAN_DSTARLITE_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../Map.h"
+
+namespace gridplan {
+
+    // Ergebnis einer Anfrage an DStarLite
+    struct IncrementalResult {
+        int pathLength = -1;                    // in Kosteneinheiten (costScale), -1 = kein Weg
+        std::vector<std::pair<int, int>> path;  // (Zeile, Spalte) vom Start zum Ziel
+        long long expansions = 0;               // in diesem Aufruf (erneut) expandierte Knoten
+        bool fullSearch = false;                // true: Suchbaum neu aufgebaut (erste Anfrage, neues Ziel)
+    };
+
+    class IncrementalSearch;
+
+    // Inkrementelle Planung mit D* Lite (Koenig/Likhachev), d. h. LPA* rueckwaerts vom Ziel.
+    // Der Planer haelt g, rhs und die offene Liste zwischen den Anfragen fest und arbeitet auf
+    // der uebergebenen Karte, die weiter veraendert werden darf (gleiche Groesse). Nach
+    // Aenderungen einzelner Kacheln oder einem verschobenen Start werden nur die inkonsistent
+    // gewordenen Knoten neu expandiert; Pfadlaenge und Pfad sind dieselben wie bei aStar mit
+    // Octile-Heuristik (4er: gleich Manhattan). Siehe DStarLite.cpp.
+    class DStarLite {
+    public:
+        DStarLite(const Map& map, int connectivity = 4);
+        ~DStarLite();
+
+        // Weg von (startX, startY) nach (goalX, goalY). Bei gleichem Ziel wie zuvor wird der
+        // Suchbaum weiterverwendet (nur der Start wandert), sonst von vorn aufgebaut.
+        IncrementalResult plan(int startX, int startY, int goalX, int goalY);
+
+        // Nach Map::setTile auf den Feldern changedCells (x, y): repariert den Suchbaum fuer
+        // diese Felder und plant vom (ggf. neuen) Start zum bisherigen Ziel. Vor dem ersten
+        // plan() ohne Wirkung (Rueckgabe -1).
+        IncrementalResult replan(int startX, int startY, const std::vector<std::pair<int, int>>& changedCells);
+
+        int getConnectivity() const { return connectivity; }
+
+    private:
+        int connectivity;
+        std::unique_ptr<IncrementalSearch> search;
+    };
+
+}
+
+#endif
@@ -0,0 +1,315 @@
+#include "Planners.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "../BitOps.h"
+#include "Workers.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GRIDPLAN_SSE2
+#endif
+
+using namespace std;
+
+// Brushfire als Distanztransformation in Rasterdurchlaeufen (Chamfer) statt Flutung.
+//
+// Mit den Hindernissen als Quellen ist die Entfernung der Breitensuche gleich dem Abstand
+// ohne Barrieren: ein kuerzester Weg zum naechsten Hindernis laeuft monoton, und ein
+// Hindernis auf diesem Weg waere noch naeher. Das gilt fuer Manhattan- (4er) und
+// Schachbrettabstand (8er), auch ohne Eckenschneiden, denn ein gesperrter Diagonalzug
+// liegt immer direkt neben einem Hindernis.
+//
+// 4er: separabel. Erst der Abstand innerhalb jeder Zeile (vorwaerts und rueckwaerts,
+// Zeilenbloecke parallel), dann spaltenweise d(y) = min(d(y), d(y -+ 1) + 1) abwaerts und
+// aufwaerts. Der zweite Schritt ist elementweise ueber eine ganze Zeile, also SSE2 mit
+// vier Spalten je Befehl, und die Spaltenstreifen laufen parallel.
+// 8er: klassische 3x3-Maske vorwaerts und rueckwaerts; der Schritt aus der Nachbarzeile ist
+// vektorisiert, die Zeilen haengen aber voneinander ab (ein Thread).
+//
+// Euklidisch (exakt, quadriert): ebenfalls separabel nach Meijster/Felzenszwalb. Der
+// Spaltenschritt ist derselbe wie bei Manhattan ohne Zeilendurchlauf und liefert je Feld
+// den Abstand g zum naechsten Hindernis der eigenen Spalte. Danach ist jede Zeile
+// unabhaengig: d^2(x) = min ueber i von (x - i)^2 + g(i)^2, die untere Huelle der Parabeln
+// in O(Breite). Beide Schritte laufen parallel (Spaltenstreifen, dann Zeilenbloecke).
+namespace gridplan {
+
+    namespace {
+
+        // "Unendlich": bleibt bei w + h Additionen von 1 weit unter INT_MAX
+        const int FAR = INT_MAX / 2;
+
+#ifdef GRIDPLAN_SSE2
+        // SSE2 hat kein _mm_min_epi32 (erst SSE4.1)
+        inline __m128i minEpi32(__m128i a, __m128i b) {
+            __m128i greater = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+        }
+#endif
+
+        // out[x] = min(out[x], src[x] + 1) fuer x in [begin, end)
+        void relaxFrom(int* out, const int* src, int begin, int end) {
+            int x = begin;
+#ifdef GRIDPLAN_SSE2
+            const __m128i one = _mm_set1_epi32(1);
+            for (; x + 4 <= end; x += 4) {
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + x));
+                __m128i s = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x)), one);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), minEpi32(d, s));
+            }
+#endif
+            for (; x < end; x++) {
+                out[x] = min(out[x], src[x] + 1);
+            }
+        }
+
+        // 8er: out[x] = min(out[x], min(src[x - 1], src[x], src[x + 1]) + 1)
+        void relaxFromThree(int* out, const int* src, int width) {
+            auto relaxOne = [&](int x) {
+                int m = src[x];
+                if (x > 0) {
+                    m = min(m, src[x - 1]);
+                }
+                if (x + 1 < width) {
+                    m = min(m, src[x + 1]);
+                }
+                out[x] = min(out[x], m + 1);
+            };
+            relaxOne(0);
+            int x = 1;
+#ifdef GRIDPLAN_SSE2
+            const __m128i one = _mm_set1_epi32(1);
+            for (; x + 4 < width; x += 4) {
+                __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x - 1));
+                __m128i middle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+                __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x + 1));
+                __m128i s = _mm_add_epi32(minEpi32(minEpi32(left, middle), right), one);
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + x));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), minEpi32(d, s));
+            }
+#endif
+            for (; x < width; x++) {
+                relaxOne(x);
+            }
+        }
+
+        // Zeile y: Hindernisse 0, sonst FAR (Hindernis-Bitmap wortweise)
+        void seedRow(const Map& map, int y, int* out) {
+            int width = map.getWidth();
+            fill(out, out + width, FAR);
+            const uint64_t* bits = map.obstacleRow(y);
+            for (int w = 0; w < map.getObstacleWordsPerRow(); w++) {
+                uint64_t word = bits[w];
+                while (word != 0) {
+                    int x = w * 64 + countTrailingZeros(word) - 1; // Bit x + 1 gehoert zu Spalte x
+                    word &= word - 1;
+                    if (x >= 0 && x < width) {
+                        out[x] = 0;
+                    }
+                }
+            }
+        }
+
+        // Abstand innerhalb der Zeile: von links, dann von rechts
+        void sweepLeft(int* d, int width) {
+            for (int x = 1; x < width; x++) {
+                d[x] = min(d[x], d[x - 1] + 1);
+            }
+        }
+        void sweepRight(int* d, int width) {
+            for (int x = width - 2; x >= 0; x--) {
+                d[x] = min(d[x], d[x + 1] + 1);
+            }
+        }
+
+        bool hasObstacle(const Map& map) {
+            int words = map.getObstacleWordsPerRow();
+            int width = map.getWidth();
+            for (int y = 0; y < map.getHeight(); y++) {
+                const uint64_t* bits = map.obstacleRow(y);
+                for (int w = 0; w < words; w++) {
+                    uint64_t word = bits[w];
+                    while (word != 0) {
+                        int x = w * 64 + countTrailingZeros(word) - 1;
+                        word &= word - 1;
+                        if (x >= 0 && x < width) {
+                            return true;
+                        }
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Spaltenschritt fuer Manhattan und Euklid: d(y) = min(d(y), d(y -+ 1) + 1) abwaerts und
+        // aufwaerts, parallel ueber Spaltenstreifen aus ganzen Cache-Zeilen (16 int)
+        void columnPass(vector<int*>& rows, int width, int height, int threads) {
+            size_t strips = (static_cast<size_t>(width) + 15) / 16;
+            runWorkers(threads, [&](int t) {
+                int begin = static_cast<int>(sliceBegin(strips, t, threads) * 16);
+                int end = min(width, static_cast<int>(sliceBegin(strips, t + 1, threads) * 16));
+                if (begin >= end) {
+                    return;
+                }
+                for (int y = 1; y < height; y++) {
+                    relaxFrom(rows[y], rows[y - 1], begin, end);
+                }
+                for (int y = height - 2; y >= 0; y--) {
+                    relaxFrom(rows[y], rows[y + 1], begin, end);
+                }
+            });
+        }
+
+        void manhattanTransform(const Map& map, vector<int*>& rows, int threads) {
+            int width = map.getWidth(), height = map.getHeight();
+            runWorkers(threads, [&](int t) {
+                for (int y = static_cast<int>(sliceBegin(height, t, threads)); y < static_cast<int>(sliceBegin(height, t + 1, threads)); y++) {
+                    seedRow(map, y, rows[y]);
+                    sweepLeft(rows[y], width);
+                    sweepRight(rows[y], width);
+                }
+            });
+            columnPass(rows, width, height, threads);
+        }
+
+        // Untere Huelle der Parabeln f_i(x) = (x - i)^2 + g(i)^2 einer Zeile (Meijster). Spalten
+        // ohne Hindernis (g = FAR) tragen keine Parabel bei. sites/starts sind Puffer des
+        // Threads: Scheitel der Huelle und die erste Spalte, ab der sie gilt.
+        void lowerEnvelope(const int* g, int64_t* out, int width, vector<int>& sites, vector<int>& starts) {
+            auto f = [&](int x, int i) {
+                int64_t dx = x - i;
+                return dx * dx + static_cast<int64_t>(g[i]) * g[i];
+            };
+            // Letzte Spalte, in der f_i noch nicht groesser als f_u ist (i < u). Der Zaehler ist
+            // nie negativ, weil f_u bei starts[q] >= 0 nicht gewinnt, die Division rundet also ab.
+            auto separation = [&](int i, int u) {
+                int64_t numerator = static_cast<int64_t>(u) * u - static_cast<int64_t>(i) * i
+                    + static_cast<int64_t>(g[u]) * g[u] - static_cast<int64_t>(g[i]) * g[i];
+                return numerator / (2 * static_cast<int64_t>(u - i));
+            };
+            int q = -1;
+            for (int u = 0; u < width; u++) {
+                if (g[u] >= FAR) {
+                    continue;
+                }
+                while (q >= 0 && f(starts[q], sites[q]) > f(starts[q], u)) {
+                    q--;
+                }
+                if (q < 0) {
+                    q = 0;
+                    sites[0] = u;
+                    starts[0] = 0;
+                }
+                else {
+                    int64_t w = 1 + separation(sites[q], u);
+                    if (w < width) {
+                        q++;
+                        sites[q] = u;
+                        starts[q] = static_cast<int>(w);
+                    }
+                }
+            }
+            for (int x = width - 1; x >= 0; x--) {
+                out[x] = f(x, sites[q]);
+                if (x == starts[q]) {
+                    q--;
+                }
+            }
+        }
+
+        void euclideanTransform(const Map& map, vector<int*>& rows, int threads, DistanceEncoding encoding) {
+            int width = map.getWidth(), height = map.getHeight();
+            runWorkers(threads, [&](int t) {
+                for (int y = static_cast<int>(sliceBegin(height, t, threads)); y < static_cast<int>(sliceBegin(height, t + 1, threads)); y++) {
+                    seedRow(map, y, rows[y]);
+                }
+            });
+            columnPass(rows, width, height, threads);
+            // Jede Zeile braucht nur ihr eigenes g und hat mindestens eine Parabel, da die Karte
+            // ein Hindernis enthaelt; das Ergebnis geht ueber einen Zeilenpuffer zurueck
+            runWorkers(threads, [&](int t) {
+                vector<int> sites(width), starts(width);
+                vector<int64_t> squared(width);
+                for (int y = static_cast<int>(sliceBegin(height, t, threads)); y < static_cast<int>(sliceBegin(height, t + 1, threads)); y++) {
+                    lowerEnvelope(rows[y], squared.data(), width, sites, starts);
+                    for (int x = 0; x < width; x++) {
+                        int64_t d2 = squared[x];
+                        int64_t value = encoding == DistanceEncoding::Fixed
+                            ? static_cast<int64_t>(sqrt(static_cast<double>(d2)) * EUCLIDEAN_FIXED_SCALE + 0.5)
+                            : d2;
+                        rows[y][x] = static_cast<int>(min<int64_t>(value, INT_MAX));
+                    }
+                }
+            });
+        }
+
+        void chessboardTransform(const Map& map, vector<int*>& rows) {
+            int width = map.getWidth(), height = map.getHeight();
+            for (int y = 0; y < height; y++) {
+                seedRow(map, y, rows[y]);
+                if (y > 0) {
+                    relaxFromThree(rows[y], rows[y - 1], width);
+                }
+                sweepLeft(rows[y], width);
+            }
+            for (int y = height - 1; y >= 0; y--) {
+                if (y + 1 < height) {
+                    relaxFromThree(rows[y], rows[y + 1], width);
+                }
+                sweepRight(rows[y], width);
+            }
+        }
+
+        // Gemeinsamer Rahmen: leere Karte, Threadzahl und die zeilenweise Arbeitsmatrix.
+        // transform(rows, threads) fuellt die Zeilen.
+        template <typename Transform>
+        void transformRows(const Map& map, Grid<int>& visited, int threads, Transform transform) {
+            int width = map.getWidth(), height = map.getHeight();
+            if (!hasObstacle(map)) {
+                visited.fill(-1);  // wie die Breitensuche: ohne Quelle bleibt alles unbesucht
+                return;
+            }
+            threads = max(1, min(resolveThreadCount(threads), height));
+
+            // Zeilenweise Arbeitsmatrix: bei RowMajor direkt visited, sonst ein Puffer
+            bool direct = visited.getLayout() == GridLayout::RowMajor;
+            vector<int> buffer(direct ? 0 : static_cast<size_t>(width) * height);
+            vector<int*> rows(height);
+            for (int y = 0; y < height; y++) {
+                rows[y] = direct ? visited.row(y) : buffer.data() + static_cast<size_t>(y) * width;
+            }
+
+            transform(rows, threads);
+
+            if (!direct) {
+                runWorkers(threads, [&](int t) {
+                    for (int y = static_cast<int>(sliceBegin(height, t, threads)); y < static_cast<int>(sliceBegin(height, t + 1, threads)); y++) {
+                        for (int x = 0; x < width; x++) {
+                            visited.at(x, y) = rows[y][x];
+                        }
+                    }
+                });
+            }
+        }
+    }
+
+    void brushfireChamfer(const Map& map, Grid<int>& visited, int threads, int connectivity) {
+        transformRows(map, visited, threads, [&](vector<int*>& rows, int workers) {
+            if (connectivity == 8) {
+                chessboardTransform(map, rows);
+            }
+            else {
+                manhattanTransform(map, rows, workers);
+            }
+        });
+    }
+
+    void brushfireEuclidean(const Map& map, Grid<int>& visited, int threads, DistanceEncoding encoding) {
+        transformRows(map, visited, threads, [&](vector<int*>& rows, int workers) {
+            euclideanTransform(map, rows, workers, encoding);
+        });
+    }
+
+}
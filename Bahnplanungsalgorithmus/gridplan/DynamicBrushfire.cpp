@@ -0,0 +1,153 @@
+#include "DynamicBrushfire.h"
+#include <algorithm>
+#include "Planners.h"
+
+using namespace std;
+
+// Dynamischer Brushfire (vgl. Kalra et al., "Incremental Reconstruction of Generalized Voronoi
+// Diagrams on Grids") fuer Schrittabstaende.
+//
+// Wie bei brushfireChamfer ist der Abstand der Breitensuche gleich dem Abstand ohne Barrieren,
+// d. h. jedes freie Feld hat d = 1 + min(d der Nachbarn) und Hindernisse d = 0. Damit gilt:
+// - Ein neues Hindernis kann Abstaende nur verkleinern. Eine Breitensuche ab dem Hindernis
+//   senkt alle Felder ab, die dadurch naeher an ein Hindernis ruecken, und haelt an, sobald
+//   kein Nachbar mehr kleiner wird.
+// - Ein entferntes Hindernis kann Abstaende nur vergroessern. Ein Feld mit Abstand k bleibt
+//   gueltig, solange ein Nachbar den Abstand k - 1 hat. Die Anhebewelle laeuft ab dem
+//   Hindernis in der Reihenfolge der alten Abstaende und verwirft jedes Feld ohne solchen
+//   Nachbarn (beim Einreihen, so dass beim Pruefen der Ebene k alle verworfenen Felder der
+//   Ebene k - 1 schon markiert sind). Die noch gueltigen Nachbarn der verworfenen Region sind
+//   der Rand, von dem aus die Absenkwelle die Region wieder auffuellt. Der Rand wird nach
+//   Abstand sortiert und mit der FIFO-Schlange der Welle zusammengefuehrt, so dass die Felder
+//   wie bei Dial in aufsteigender Reihenfolge abgearbeitet werden.
+namespace gridplan {
+
+    namespace {
+        const int DX[8] = { 0, 0, -1, 1, -1, 1, -1, 1 };
+        const int DY[8] = { -1, 1, 0, 0, -1, -1, 1, 1 };
+    }
+
+    DynamicBrushfire::DynamicBrushfire(int connectivity)
+        : connectivity(normalizeConnectivity(connectivity)) {}
+
+    void DynamicBrushfire::reset(const Map& map) {
+        width = map.getWidth();
+        height = map.getHeight();
+        distance = Grid<int>(width, height, -1, map.getLayout());
+        brushfireChamfer(map, distance, 1, connectivity);
+        obstacle.assign(static_cast<size_t>(width) * height, 0);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                obstacle[static_cast<size_t>(y) * width + x] = map.isObstacle(x, y) ? 1 : 0;
+            }
+        }
+    }
+
+    size_t DynamicBrushfire::update(const Map& map, int x, int y) {
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            return 0;
+        }
+        return setObstacle(x, y, map.isObstacle(x, y));
+    }
+
+    size_t DynamicBrushfire::setObstacle(int x, int y, bool isObstacle) {
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            return 0;
+        }
+        uint8_t& current = obstacle[static_cast<size_t>(y) * width + x];
+        if ((current != 0) == isObstacle) {
+            return 0;
+        }
+        current = isObstacle ? 1 : 0;
+
+        boundary.clear();
+        size_t touched = 0;
+        if (isObstacle) {
+            distance.at(x, y) = 0;
+            boundary.push_back({ static_cast<uint32_t>(y) * width + x, 0 });
+            touched = 1;
+        }
+        else {
+            touched = raise(x, y);
+        }
+        return touched + lower();
+    }
+
+    // Verwirft ab dem entfernten Hindernis (x, y) alle Felder ohne gueltigen Vorgaenger und
+    // sammelt die gueltigen Nachbarn der verworfenen Region in boundary
+    size_t DynamicBrushfire::raise(int x, int y) {
+        int neighbours = connectivity;
+        raiseQueue.clear();
+        distance.at(x, y) = -1;
+        raiseQueue.push_back({ static_cast<uint32_t>(y) * width + x, 0 });
+
+        // Hat (cx, cy) einen Nachbarn mit Abstand level?
+        auto supported = [&](int cx, int cy, int level) {
+            for (int n = 0; n < neighbours; n++) {
+                int nx = cx + DX[n], ny = cy + DY[n];
+                if (nx >= 0 && nx < width && ny >= 0 && ny < height && distance.at(nx, ny) == level) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (size_t head = 0; head < raiseQueue.size(); head++) {
+            Entry entry = raiseQueue[head];
+            int ux = static_cast<int>(entry.cell % width), uy = static_cast<int>(entry.cell / width);
+            for (int n = 0; n < neighbours; n++) {
+                int nx = ux + DX[n], ny = uy + DY[n];
+                if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+                    continue;
+                }
+                int& d = distance.at(nx, ny);
+                if (d < 0) {
+                    continue;
+                }
+                uint32_t cell = static_cast<uint32_t>(ny) * width + nx;
+                if (d == entry.distance + 1 && !supported(nx, ny, entry.distance)) {
+                    d = -1;
+                    raiseQueue.push_back({ cell, entry.distance + 1 });
+                }
+                else {
+                    boundary.push_back({ cell, d });
+                }
+            }
+        }
+        return raiseQueue.size();
+    }
+
+    // Absenkwelle ab boundary; Rueckgabe: Anzahl der abgesenkten Felder
+    size_t DynamicBrushfire::lower() {
+        int neighbours = connectivity;
+        sort(boundary.begin(), boundary.end(), [](const Entry& a, const Entry& b) { return a.distance < b.distance; });
+        lowerQueue.clear();
+        size_t next = 0, head = 0;
+        while (next < boundary.size() || head < lowerQueue.size()) {
+            Entry entry;
+            if (head == lowerQueue.size() || (next < boundary.size() && boundary[next].distance <= lowerQueue[head].distance)) {
+                entry = boundary[next++];
+            }
+            else {
+                entry = lowerQueue[head++];
+            }
+            int ux = static_cast<int>(entry.cell % width), uy = static_cast<int>(entry.cell / width);
+            if (distance.at(ux, uy) != entry.distance) {
+                continue;  // veraltet: inzwischen verworfen oder weiter abgesenkt
+            }
+            for (int n = 0; n < neighbours; n++) {
+                int nx = ux + DX[n], ny = uy + DY[n];
+                if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+                    continue;
+                }
+                int& d = distance.at(nx, ny);
+                if (d < 0 || d > entry.distance + 1) {
+                    d = entry.distance + 1;
+                    lowerQueue.push_back({ static_cast<uint32_t>(ny) * width + nx, d });
+                }
+            }
+        }
+        return lowerQueue.size();
+    }
+
+}
@@ -0,0 +1,59 @@
+#ifndef GRIDPLAN_DYNAMICBRUSHFIRE_H
+#define GRIDPLAN_DYNAMICBRUSHFIRE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Grid.h"
+#include "../Map.h"
+
+namespace gridplan {
+
+    // Dynamischer Brushfire: haelt das Abstandsfeld (wie brushfire, 4er- oder 8er-Nachbarschaft)
+    // im Speicher und repariert es beim Setzen oder Entfernen einzelner Hindernisse, statt es
+    // neu zu berechnen. Ein neues Hindernis senkt die Werte per Breitensuche ab ("lower"); ein
+    // entferntes Hindernis verwirft zuerst alle Felder, deren Abstand nur ueber dieses Hindernis
+    // begruendet war ("raise"), und fuellt sie danach vom Rand der verworfenen Region wieder auf.
+    // Beruehrt werden nur die betroffenen Felder, siehe DynamicBrushfire.cpp.
+    class DynamicBrushfire {
+    public:
+        explicit DynamicBrushfire(int connectivity = 4);
+
+        // Vollstaendige Berechnung fuer die Karte (Distanztransformation wie brushfireChamfer)
+        void reset(const Map& map);
+
+        // Gleicht die Kachel (x, y) mit der Karte ab, z. B. nach Map::setTile im Editor.
+        // Rueckgabe: Anzahl der angefassten Felder (0, wenn sich nichts geaendert hat).
+        size_t update(const Map& map, int x, int y);
+
+        // Setzt bzw. entfernt ein Hindernis; Rueckgabe wie bei update
+        size_t setObstacle(int x, int y, bool obstacle);
+
+        // Abstand jedes Feldes zum naechsten Hindernis (Hindernisse = 0, -1 ohne Hindernis),
+        // Feld fuer Feld gleich wie brushfire auf der aktuellen Karte
+        const Grid<int>& distances() const { return distance; }
+        int getConnectivity() const { return connectivity; }
+
+    private:
+        // Eintrag der Wellen: Feld (y * width + x) und sein Abstand beim Einreihen
+        struct Entry {
+            uint32_t cell;
+            int distance;
+        };
+
+        size_t raise(int x, int y);
+        size_t lower();
+
+        int connectivity;
+        int width = 0, height = 0;
+        Grid<int> distance;
+        std::vector<uint8_t> obstacle;      // 1 = Hindernis, zeilenweise
+        // Arbeitspuffer, bleiben zwischen den Aufrufen erhalten
+        std::vector<Entry> raiseQueue;
+        std::vector<Entry> boundary;        // Startfelder der Absenkwelle
+        std::vector<Entry> lowerQueue;
+    };
+
+}
+
+#endif
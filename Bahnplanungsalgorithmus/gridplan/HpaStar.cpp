@@ -0,0 +1,406 @@
+#include "HpaStar.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include "../BitOps.h"
+#include "SearchPolicies.h"
+
+using namespace std;
+
+// Aufbau: fuer jede Kante zwischen zwei benachbarten Clustern werden die Eingaenge gesucht
+// (buildBorder) und als Knotenpaare mit einem geraden Schritt verbunden; danach berechnet
+// computeDistances je Cluster mit einer Dijkstra-Suche pro Knoten die Entfernungen zwischen
+// allen Knoten des Clusters. Knoten gehoeren zu genau einem Cluster (dem ihrer Zelle); eine
+// Eckzelle kann Uebergaenge zu zwei Kanten tragen.
+//
+// Aenderung einer Kachel: innerhalb eines Clusters aendern sich nur dessen Entfernungen. Liegt
+// die Kachel auf dem Rand, koennen sich zusaetzlich die Eingaenge der Kante aendern; dann wird
+// die Kante neu aufgebaut und auch der Cluster auf der anderen Seite neu berechnet.
+//
+// Erreichbarkeit bleibt erhalten: jeder Weg zwischen zwei Clustern ueberquert die Kante mit
+// einem geraden Schritt (ein Diagonalzug ohne Eckenschneiden hat immer auch einen geraden
+// Ersatz), also innerhalb eines Eingangs, und alle Zellen eines Eingangs liegen auf beiden
+// Seiten zusammenhaengend entlang der Kante.
+namespace gridplan {
+
+    namespace {
+        const int INF = INT_MAX / 4;
+        // Eingaenge ab dieser Laenge erhalten zwei Uebergaenge (an den Enden), sonst einen
+        const int LONG_ENTRANCE = 6;
+    }
+
+    HpaStar::HpaStar(const Map& map, int clusterSize, int connectivity)
+        : map(map), clusterSize(max(2, clusterSize)), connectivity(normalizeConnectivity(connectivity)) {
+        int width = map.getWidth(), height = map.getHeight();
+        clustersX = (width + this->clusterSize - 1) / this->clusterSize;
+        clustersY = (height + this->clusterSize - 1) / this->clusterSize;
+        clusters.resize(static_cast<size_t>(clustersX) * clustersY);
+        for (int cy = 0; cy < clustersY; cy++) {
+            for (int cx = 0; cx < clustersX; cx++) {
+                Cluster& cluster = clusters[static_cast<size_t>(cy) * clustersX + cx];
+                cluster.x0 = cx * this->clusterSize;
+                cluster.y0 = cy * this->clusterSize;
+                cluster.x1 = min(width, cluster.x0 + this->clusterSize) - 1;
+                cluster.y1 = min(height, cluster.y0 + this->clusterSize) - 1;
+            }
+        }
+        for (int cy = 0; cy < clustersY; cy++) {
+            for (int cx = 0; cx < clustersX; cx++) {
+                int k = cy * clustersX + cx;
+                if (cx + 1 < clustersX) {
+                    buildBorder(k, k + 1, true);
+                }
+                if (cy + 1 < clustersY) {
+                    buildBorder(k, k + clustersX, false);
+                }
+            }
+        }
+        for (int k = 0; k < static_cast<int>(clusters.size()); k++) {
+            computeDistances(k);
+        }
+    }
+
+    int HpaStar::clusterOf(int x, int y) const {
+        return (y / clusterSize) * clustersX + x / clusterSize;
+    }
+
+    int HpaStar::local(int cluster, int x, int y) const {
+        const Cluster& c = clusters[cluster];
+        return (y - c.y0) * (c.x1 - c.x0 + 1) + (x - c.x0);
+    }
+
+    int HpaStar::nodeAt(int cluster, int x, int y) {
+        Cluster& c = clusters[cluster];
+        for (int id : c.nodes) {
+            if (nodes[id].x == x && nodes[id].y == y) {
+                return id;
+            }
+        }
+        int id;
+        if (!freeNodes.empty()) {
+            id = freeNodes.back();
+            freeNodes.pop_back();
+        }
+        else {
+            id = static_cast<int>(nodes.size());
+            nodes.emplace_back();
+        }
+        Node& node = nodes[id];
+        node.x = x;
+        node.y = y;
+        node.cluster = cluster;
+        node.slot = static_cast<int>(c.nodes.size());
+        node.partners.clear();
+        c.nodes.push_back(id);
+        return id;
+    }
+
+    // Loest die Uebergaenge zwischen a und b; Knoten ohne weitere Uebergaenge entfallen
+    void HpaStar::detachBorder(int a, int b) {
+        for (int side = 0; side < 2; side++) {
+            int there = side == 0 ? b : a;
+            for (int id : clusters[side == 0 ? a : b].nodes) {
+                vector<int>& partners = nodes[id].partners;
+                partners.erase(remove_if(partners.begin(), partners.end(),
+                    [&](int p) { return nodes[p].cluster == there; }), partners.end());
+            }
+        }
+        for (int side = 0; side < 2; side++) {
+            Cluster& c = clusters[side == 0 ? a : b];
+            vector<int> kept;
+            for (int id : c.nodes) {
+                if (nodes[id].partners.empty()) {
+                    nodes[id].cluster = -1;
+                    freeNodes.push_back(id);
+                }
+                else {
+                    nodes[id].slot = static_cast<int>(kept.size());
+                    kept.push_back(id);
+                }
+            }
+            c.nodes.swap(kept);
+        }
+    }
+
+    // Eingaenge der Kante zwischen a und dem rechten (vertical) bzw. unteren Nachbarn b
+    void HpaStar::buildBorder(int a, int b, bool vertical) {
+        detachBorder(a, b);
+        const Cluster& ca = clusters[a];
+        int begin = vertical ? ca.y0 : ca.x0;
+        int end = vertical ? ca.y1 : ca.x1;
+        auto cellA = [&](int i) { return vertical ? make_pair(ca.x1, i) : make_pair(i, ca.y1); };
+        auto cellB = [&](int i) { return vertical ? make_pair(ca.x1 + 1, i) : make_pair(i, ca.y1 + 1); };
+        auto open = [&](int i) {
+            pair<int, int> p = cellA(i), q = cellB(i);
+            return !map.isObstacle(p.first, p.second) && !map.isObstacle(q.first, q.second);
+        };
+        auto addTransition = [&](int i) {
+            pair<int, int> p = cellA(i), q = cellB(i);
+            int na = nodeAt(a, p.first, p.second);
+            int nb = nodeAt(b, q.first, q.second);
+            if (find(nodes[na].partners.begin(), nodes[na].partners.end(), nb) == nodes[na].partners.end()) {
+                nodes[na].partners.push_back(nb);
+                nodes[nb].partners.push_back(na);
+            }
+        };
+        int segment = -1;
+        for (int i = begin; i <= end + 1; i++) {
+            bool free = i <= end && open(i);
+            if (free && segment < 0) {
+                segment = i;
+            }
+            else if (!free && segment >= 0) {
+                int last = i - 1;
+                if (last - segment + 1 >= LONG_ENTRANCE) {
+                    addTransition(segment);
+                    addTransition(last);
+                }
+                else {
+                    addTransition(segment + (last - segment) / 2);
+                }
+                segment = -1;
+            }
+        }
+    }
+
+    void HpaStar::computeDistances(int cluster) {
+        Cluster& c = clusters[cluster];
+        size_t count = c.nodes.size();
+        c.distance.assign(count * count, INF);
+        LocalSearch search;
+        long long expansions = 0;
+        // Die Entfernungen sind symmetrisch: die Suche ab Knoten i fuellt Zeile und Spalte i ab
+        // der Diagonale, die Suche ab dem letzten Knoten entfaellt
+        for (size_t i = 0; i + 1 < count; i++) {
+            const Node& from = nodes[c.nodes[i]];
+            searchCluster(cluster, from.x, from.y, -1, -1, search, expansions);
+            for (size_t j = i + 1; j < count; j++) {
+                const Node& to = nodes[c.nodes[j]];
+                int d = search.distance[local(cluster, to.x, to.y)];
+                c.distance[i * count + j] = d;
+                c.distance[j * count + i] = d;
+            }
+        }
+        for (size_t i = 0; i < count; i++) {
+            c.distance[i * count + i] = 0;
+        }
+    }
+
+    int HpaStar::updateTile(int x, int y) {
+        if (x < 0 || x >= map.getWidth() || y < 0 || y >= map.getHeight()) {
+            return 0;
+        }
+        int k = clusterOf(x, y);
+        const Cluster& c = clusters[k];
+        int cx = k % clustersX, cy = k / clustersX;
+        vector<int> rebuilt = { k };
+        if (x == c.x0 && cx > 0) {
+            buildBorder(k - 1, k, true);
+            rebuilt.push_back(k - 1);
+        }
+        if (x == c.x1 && cx + 1 < clustersX) {
+            buildBorder(k, k + 1, true);
+            rebuilt.push_back(k + 1);
+        }
+        if (y == c.y0 && cy > 0) {
+            buildBorder(k - clustersX, k, false);
+            rebuilt.push_back(k - clustersX);
+        }
+        if (y == c.y1 && cy + 1 < clustersY) {
+            buildBorder(k, k + clustersX, false);
+            rebuilt.push_back(k + clustersX);
+        }
+        for (int cluster : rebuilt) {
+            computeDistances(cluster);
+        }
+        return static_cast<int>(rebuilt.size());
+    }
+
+    template <typename Neighbourhood>
+    void HpaStar::searchClusterWith(int cluster, int x, int y, int targetX, int targetY, LocalSearch& search,
+        long long& expansions) const {
+        const Cluster& c = clusters[cluster];
+        int width = c.x1 - c.x0 + 1;
+        size_t cells = static_cast<size_t>(width) * (c.y1 - c.y0 + 1);
+        search.distance.assign(cells, INF);
+        search.parent.assign(cells, -1);
+        if (map.isObstacle(x, y)) {
+            return;
+        }
+        // Ein Zug kostet hoechstens diagonalCost, offene Schluessel liegen also in einem Fenster
+        // von diagonalCost + 1 Eimern; veraltete Eintraege werden beim Entnehmen uebersprungen
+        const int ring = Neighbourhood::diagonalCost + 1;
+        search.buckets.resize(ring);
+        for (vector<int>& bucket : search.buckets) {
+            bucket.clear();
+        }
+        int target = targetX >= 0 ? local(cluster, targetX, targetY) : -1;
+        int start = local(cluster, x, y);
+        search.distance[start] = 0;
+        search.buckets[0].push_back(start);
+        size_t pending = 1;
+        for (int d = 0; pending > 0; d++) {
+            vector<int>& bucket = search.buckets[d % ring];
+            while (!bucket.empty()) {
+                int i = bucket.back();
+                bucket.pop_back();
+                pending--;
+                if (search.distance[i] != d) {
+                    continue;
+                }
+                expansions++;
+                if (i == target) {
+                    return;
+                }
+                int ux = c.x0 + i % width, uy = c.y0 + i / width;
+                for (unsigned freeMask = Neighbourhood::moves(map, ux, uy); freeMask != 0; freeMask &= freeMask - 1) {
+                    int dir = countTrailingZeros(freeMask);
+                    int nx = ux + Neighbourhood::dx[dir], ny = uy + Neighbourhood::dy[dir];
+                    if (nx < c.x0 || nx > c.x1 || ny < c.y0 || ny > c.y1) {
+                        continue;
+                    }
+                    int next = (ny - c.y0) * width + (nx - c.x0);
+                    int nd = d + Neighbourhood::cost[dir];
+                    if (nd < search.distance[next]) {
+                        search.distance[next] = nd;
+                        search.parent[next] = i;
+                        search.buckets[nd % ring].push_back(next);
+                        pending++;
+                    }
+                }
+            }
+        }
+    }
+
+    void HpaStar::searchCluster(int cluster, int x, int y, int targetX, int targetY, LocalSearch& search,
+        long long& expansions) const {
+        if (connectivity == 8) {
+            searchClusterWith<EightConnected>(cluster, x, y, targetX, targetY, search, expansions);
+        }
+        else {
+            searchClusterWith<FourConnected>(cluster, x, y, targetX, targetY, search, expansions);
+        }
+    }
+
+    template <typename Neighbourhood>
+    pair<int, vector<pair<int, int>>> HpaStar::findPathIn(int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, SearchStats& stats) const {
+        if (map.isObstacle(startX, startY) || map.isObstacle(goalX, goalY)) {
+            return { -1, {} };
+        }
+        int startCluster = clusterOf(startX, startY), goalCluster = clusterOf(goalX, goalY);
+
+        // Start und Ziel an die Knoten ihres Clusters anbinden
+        LocalSearch fromStart, fromGoal;
+        searchClusterWith<Neighbourhood>(startCluster, startX, startY, -1, -1, fromStart, stats.expansions);
+        searchClusterWith<Neighbourhood>(goalCluster, goalX, goalY, -1, -1, fromGoal, stats.expansions);
+        int direct = startCluster == goalCluster ? fromStart.distance[local(startCluster, goalX, goalY)] : INF;
+
+        // A* im abstrakten Graphen; S und G sind die voruebergehenden Knoten fuer Start und Ziel
+        const int S = static_cast<int>(nodes.size()), G = S + 1;
+        const OctileHeuristic<Neighbourhood> heuristic{ goalX, goalY };
+        vector<int> g(nodes.size() + 2, INF), parent(nodes.size() + 2, -1);
+        vector<char> closed(nodes.size() + 2, 0);
+        priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> open;
+        g[S] = 0;
+        open.push({ heuristic(startX, startY), S });
+        while (!open.empty()) {
+            int u = open.top().second;
+            open.pop();
+            if (closed[u]) {
+                continue;
+            }
+            closed[u] = 1;
+            stats.expansions++;
+            if (u == G) {
+                break;
+            }
+            auto relax = [&](int v, int cost) {
+                if (cost < INF && g[u] + cost < g[v]) {
+                    g[v] = g[u] + cost;
+                    parent[v] = u;
+                    open.push({ g[v] + (v == G ? 0 : heuristic(nodes[v].x, nodes[v].y)), v });
+                    stats.pushes++;
+                }
+            };
+            if (u == S) {
+                for (int id : clusters[startCluster].nodes) {
+                    relax(id, fromStart.distance[local(startCluster, nodes[id].x, nodes[id].y)]);
+                }
+                relax(G, direct);
+                continue;
+            }
+            const Node& node = nodes[u];
+            const Cluster& c = clusters[node.cluster];
+            size_t count = c.nodes.size();
+            for (size_t j = 0; j < count; j++) {
+                if (static_cast<int>(j) != node.slot) {
+                    relax(c.nodes[j], c.distance[node.slot * count + j]);
+                }
+            }
+            for (int partner : node.partners) {
+                relax(partner, Neighbourhood::straightCost);
+            }
+            if (node.cluster == goalCluster) {
+                relax(G, fromGoal.distance[local(goalCluster, node.x, node.y)]);
+            }
+        }
+        if (g[G] >= INF) {
+            return { -1, {} };
+        }
+
+        // Abstrakten Weg verfeinern: Uebergaenge sind ein Schritt, alles andere eine Suche im Cluster
+        vector<int> abstractPath;
+        for (int v = G; v != -1; v = parent[v]) {
+            abstractPath.push_back(v);
+        }
+        reverse(abstractPath.begin(), abstractPath.end());
+        vector<pair<int, int>> cells = { { startX, startY } };  // (x, y)
+        LocalSearch search;
+        for (size_t i = 1; i < abstractPath.size(); i++) {
+            int from = abstractPath[i - 1], to = abstractPath[i];
+            int fromX = from == S ? startX : nodes[from].x, fromY = from == S ? startY : nodes[from].y;
+            int toX = to == G ? goalX : nodes[to].x, toY = to == G ? goalY : nodes[to].y;
+            int cluster = from == S ? startCluster : nodes[from].cluster;
+            if (from != S && to != G && nodes[to].cluster != cluster) {
+                cells.push_back({ toX, toY });
+                continue;
+            }
+            searchClusterWith<Neighbourhood>(cluster, fromX, fromY, toX, toY, search, stats.expansions);
+            const Cluster& c = clusters[cluster];
+            int width = c.x1 - c.x0 + 1;
+            size_t mark = cells.size();
+            for (int at = local(cluster, toX, toY); search.parent[at] != -1; at = search.parent[at]) {
+                cells.push_back({ c.x0 + at % width, c.y0 + at / width });
+            }
+            reverse(cells.begin() + mark, cells.end());
+        }
+
+        // Kosten entlang des Pfades, Pfad als (Zeile, Spalte)
+        vector<pair<int, int>> path;
+        path.reserve(cells.size());
+        int length = 0;
+        for (size_t i = 0; i < cells.size(); i++) {
+            if (i > 0) {
+                bool diagonal = cells[i].first != cells[i - 1].first && cells[i].second != cells[i - 1].second;
+                length += diagonal ? Neighbourhood::diagonalCost : Neighbourhood::straightCost;
+            }
+            visited.at(cells[i].first, cells[i].second) = length;
+            path.push_back({ cells[i].second, cells[i].first });
+        }
+        return { length, path };
+    }
+
+    pair<int, vector<pair<int, int>>> HpaStar::findPath(int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, SearchStats* stats) const {
+        SearchStats localStats;
+        SearchStats& counters = stats != nullptr ? *stats : localStats;
+        if (connectivity == 8) {
+            return findPathIn<EightConnected>(startX, startY, goalX, goalY, visited, counters);
+        }
+        return findPathIn<FourConnected>(startX, startY, goalX, goalY, visited, counters);
+    }
+
+}
@@ -0,0 +1,91 @@
+#ifndef GRIDPLAN_HPASTAR_H
+#define GRIDPLAN_HPASTAR_H
+
+#include <utility>
+#include <vector>
+#include "../Grid.h"
+#include "../Map.h"
+#include "OpenList.h"
+
+namespace gridplan {
+
+    // Hierarchische Wegplanung (HPA*, Botea/Mueller/Schaeffer). Die Karte wird in Cluster
+    // fester Groesse zerlegt. Auf jeder Kante zwischen zwei Clustern sind die Eingaenge
+    // (zusammenhaengende, auf beiden Seiten freie Abschnitte) durch einen Uebergang in der
+    // Mitte bzw. zwei an den Enden bei langen Abschnitten vertreten; die Zellen der Uebergaenge
+    // sind die Knoten des abstrakten Graphen. Je Cluster werden die Entfernungen zwischen
+    // seinen Knoten (innerhalb des Clusters) vorab berechnet und zwischengespeichert.
+    // Eine Anfrage bindet Start und Ziel an die Knoten ihres Clusters an, sucht im abstrakten
+    // Graphen und verfeinert nur die gewaehlten Abschnitte mit einer Suche im jeweiligen
+    // Cluster. Der Weg ist gueltig, aber nicht immer optimal (die Uebergaenge legen fest, wo
+    // Cluster gewechselt werden). Siehe HpaStar.cpp.
+    class HpaStar {
+    public:
+        // Baut die Abstraktion fuer die Karte auf; die Karte muss so lange bestehen bleiben
+        HpaStar(const Map& map, int clusterSize = 16, int connectivity = 4);
+
+        // Nach Map::setTile(x, y): baut nur den Cluster der Kachel neu auf, bei einer Kachel auf
+        // dem Clusterrand zusaetzlich die Eingaenge dieser Kante und den Cluster dahinter.
+        // Rueckgabe: Anzahl der neu berechneten Cluster.
+        int updateTile(int x, int y);
+
+        // Weg von (startX, startY) nach (goalX, goalY): Pfadlaenge in Kosteneinheiten der
+        // Nachbarschaft (-1 = nicht erreichbar) und Pfad als (Zeile, Spalte). visited erhaelt die
+        // Entfernung vom Start entlang des Pfades; stats zaehlt die expandierten Knoten der
+        // abstrakten Suche und aller Suchen in Clustern.
+        std::pair<int, std::vector<std::pair<int, int>>> findPath(int startX, int startY, int goalX, int goalY,
+            Grid<int>& visited, SearchStats* stats = nullptr) const;
+
+        int getClusterSize() const { return clusterSize; }
+        int getConnectivity() const { return connectivity; }
+        int getClusterCount() const { return static_cast<int>(clusters.size()); }
+        int getNodeCount() const { return static_cast<int>(nodes.size() - freeNodes.size()); }
+
+    private:
+        struct Node {
+            int x = 0, y = 0;
+            int cluster = -1;               // -1 = frei (wiederverwendbar)
+            int slot = 0;                   // Stelle in Cluster::nodes (Zeile/Spalte von distance)
+            std::vector<int> partners;      // Knoten jenseits der Clusterkante (ein gerader Schritt)
+        };
+        struct Cluster {
+            int x0 = 0, y0 = 0, x1 = 0, y1 = 0;  // Zellen [x0, x1] x [y0, y1]
+            std::vector<int> nodes;
+            std::vector<int> distance;      // nodes.size()^2 Entfernungen im Cluster (INF = getrennt)
+        };
+        // Ergebnis einer Suche innerhalb eines Clusters (Zellen relativ zu x0/y0)
+        struct LocalSearch {
+            std::vector<int> distance;
+            std::vector<int> parent;        // Vorgaenger (lokaler Index), -1 am Start
+            std::vector<std::vector<int>> buckets;  // Ringpuffer der Eimer nach Dial, wird wiederverwendet
+        };
+
+        int clusterOf(int x, int y) const;
+        int local(int cluster, int x, int y) const;
+        int nodeAt(int cluster, int x, int y);
+        void buildBorder(int a, int b, bool vertical);
+        void detachBorder(int a, int b);
+        void computeDistances(int cluster);
+
+        // Dijkstra (nach Dial) in cluster ab (x, y); mit targetX >= 0 Abbruch beim Ziel
+        template <typename Neighbourhood>
+        void searchClusterWith(int cluster, int x, int y, int targetX, int targetY, LocalSearch& search,
+            long long& expansions) const;
+        void searchCluster(int cluster, int x, int y, int targetX, int targetY, LocalSearch& search,
+            long long& expansions) const;
+        template <typename Neighbourhood>
+        std::pair<int, std::vector<std::pair<int, int>>> findPathIn(int startX, int startY, int goalX, int goalY,
+            Grid<int>& visited, SearchStats& stats) const;
+
+        const Map& map;
+        int clusterSize;
+        int connectivity;
+        int clustersX = 0, clustersY = 0;
+        std::vector<Node> nodes;
+        std::vector<int> freeNodes;
+        std::vector<Cluster> clusters;
+    };
+
+}
+
+#endif
@@ -0,0 +1,346 @@
+#include "Planners.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+
+using namespace std;
+
+// Jump Point Search fuer 4er- und 8er-Nachbarschaft.
+//
+// 4er-Nachbarschaft (Kosten 1), kanonische Ordnung: unter gleich langen Wegen wird der
+// bevorzugt, der zuerst waagrecht und dann senkrecht laeuft. Daraus folgen die Regeln:
+// - Waagrechte Bewegung hat keine erzwungenen Nachbarn, darf aber an jeder Kachel
+//   nach oben oder unten abbiegen. Ein waagrechter Sprung haelt daher an, sobald ein
+//   senkrechter Sprung von der aktuellen Kachel aus einen Sprungpunkt findet.
+// - Senkrechte Bewegung laeuft nur geradeaus weiter. Sie haelt an, wenn links oder
+//   rechts eine Kachel frei wird, deren Nachbar eine Zeile zurueck blockiert ist
+//   (erzwungener Nachbar); nur in diese Richtung darf dann abgebogen werden.
+//
+// 8er-Nachbarschaft ohne Eckenschneiden (Kosten 70/99, SearchPolicies.h), kanonische
+// Ordnung: erst diagonal, dann gerade.
+// - Ein diagonaler Schritt ist nur erlaubt, wenn beide angrenzenden geraden Nachbarn frei
+//   sind. Ein diagonaler Sprung haelt an, sobald einer der beiden geraden Teilspruenge
+//   (waagrecht oder senkrecht in Laufrichtung) einen Sprungpunkt findet.
+// - Ein gerader Sprung haelt an, wenn seitlich eine Kachel frei wird, deren Nachbar eine
+//   Kachel zurueck blockiert ist: dorthin fuehrt kein diagonaler Weg an der aktuellen
+//   Kachel vorbei. Von dort geht es geradeaus, zur Seite und diagonal nach vorne weiter.
+//
+// Sprungpunkte werden wie bei A* ueber die offene Liste verwaltet, die Kosten zwischen
+// zwei Sprungpunkten ergeben sich aus dem geraden bzw. diagonalen Abstand.
+namespace gridplan {
+
+    namespace {
+
+        int sign(int v) {
+            return (v > 0) - (v < 0);
+        }
+
+        // Gemeinsamer Teil der Sprungregeln: Hindernistest und Markierung in visited
+        struct JumpScannerBase {
+            const Map& map;
+            int goalX, goalY;
+            Grid<int>& visited;
+
+            bool isFree(int x, int y) const { return !map.isObstacle(x, y); }
+            bool isGoal(int x, int y) const { return x == goalX && y == goalY; }
+
+            // Beim Springen geprueftes Feld mit der Entfernung entlang des Sprungs markieren
+            void touch(int x, int y, int g) {
+                int& value = visited.at(x, y);
+                if (value == -1 || g < value) {
+                    value = g;
+                }
+            }
+        };
+
+        // Sprungregeln der 4er-Nachbarschaft
+        struct JumpScanner : JumpScannerBase {
+            using Neighbourhood = FourConnected;
+
+            // Erzwungener Nachbar links (side = -1) oder rechts (side = 1) bei senkrechter Bewegung dy
+            bool forcedSide(int x, int y, int dy, int side) const {
+                return isFree(x + side, y) && !isFree(x + side, y - dy);
+            }
+
+            // Senkrechter Sprung ab (x, y) in Richtung dy; g = Kosten bis (x, y)
+            bool jumpVertical(int x, int y, int dy, int g, int& jumpY) {
+                while (true) {
+                    y += dy;
+                    g++;
+                    if (!isFree(x, y)) {
+                        return false;
+                    }
+                    touch(x, y, g);
+                    if (isGoal(x, y) || forcedSide(x, y, dy, -1) || forcedSide(x, y, dy, 1)) {
+                        jumpY = y;
+                        return true;
+                    }
+                }
+            }
+
+            // Waagrechter Sprung ab (x, y) in Richtung dx; an jeder Kachel wird senkrecht gesucht
+            bool jumpHorizontal(int x, int y, int dx, int g, int& jumpX) {
+                int ignored;
+                while (true) {
+                    x += dx;
+                    g++;
+                    if (!isFree(x, y)) {
+                        return false;
+                    }
+                    touch(x, y, g);
+                    if (isGoal(x, y) || jumpVertical(x, y, -1, g, ignored) || jumpVertical(x, y, 1, g, ignored)) {
+                        jumpX = x;
+                        return true;
+                    }
+                }
+            }
+
+            bool jump(int x, int y, int dx, int dy, int g, int& jumpX, int& jumpY) {
+                jumpX = x;
+                jumpY = y;
+                return dx != 0 ? jumpHorizontal(x, y, dx, g, jumpX) : jumpVertical(x, y, dy, g, jumpY);
+            }
+
+            // Suchrichtungen nach den Regeln oben; (dx, dy) = Richtung der Ankunft
+            int successors(int x, int y, int dx, int dy, int directions[][2]) const {
+                int count = 0;
+                if (dx != 0) {
+                    int turns[3][2] = { {dx, 0}, {0, -1}, {0, 1} };
+                    for (auto& d : turns) {
+                        directions[count][0] = d[0];
+                        directions[count++][1] = d[1];
+                    }
+                    return count;
+                }
+                directions[count][0] = 0;
+                directions[count++][1] = dy;
+                for (int side = -1; side <= 1; side += 2) {
+                    if (forcedSide(x, y, dy, side)) {
+                        directions[count][0] = side;
+                        directions[count++][1] = 0;
+                    }
+                }
+                return count;
+            }
+
+            static int edgeCost(int dx, int dy) {
+                return abs(dx) + abs(dy);
+            }
+        };
+
+        // Sprungregeln der 8er-Nachbarschaft ohne Eckenschneiden
+        struct DiagonalJumpScanner : JumpScannerBase {
+            using Neighbourhood = EightConnected;
+
+            // Erzwungener Nachbar bei gerader Bewegung (dx, dy): seitlich frei, eine Kachel zurueck blockiert
+            bool forcedStraight(int x, int y, int dx, int dy) const {
+                if (dx != 0) {
+                    return (isFree(x, y - 1) && !isFree(x - dx, y - 1)) || (isFree(x, y + 1) && !isFree(x - dx, y + 1));
+                }
+                return (isFree(x - 1, y) && !isFree(x - 1, y - dy)) || (isFree(x + 1, y) && !isFree(x + 1, y - dy));
+            }
+
+            bool jumpStraight(int x, int y, int dx, int dy, int g, int& jumpX, int& jumpY) {
+                while (true) {
+                    x += dx;
+                    y += dy;
+                    g += Neighbourhood::straightCost;
+                    if (!isFree(x, y)) {
+                        return false;
+                    }
+                    touch(x, y, g);
+                    if (isGoal(x, y) || forcedStraight(x, y, dx, dy)) {
+                        jumpX = x;
+                        jumpY = y;
+                        return true;
+                    }
+                }
+            }
+
+            // Diagonaler Sprung; an jeder Kachel wird in beide geraden Teilrichtungen gesucht
+            bool jumpDiagonal(int x, int y, int dx, int dy, int g, int& jumpX, int& jumpY) {
+                int ignoredX, ignoredY;
+                while (true) {
+                    if (!isFree(x + dx, y) || !isFree(x, y + dy) || !isFree(x + dx, y + dy)) {
+                        return false;
+                    }
+                    x += dx;
+                    y += dy;
+                    g += Neighbourhood::diagonalCost;
+                    touch(x, y, g);
+                    if (isGoal(x, y) || jumpStraight(x, y, dx, 0, g, ignoredX, ignoredY)
+                        || jumpStraight(x, y, 0, dy, g, ignoredX, ignoredY)) {
+                        jumpX = x;
+                        jumpY = y;
+                        return true;
+                    }
+                }
+            }
+
+            bool jump(int x, int y, int dx, int dy, int g, int& jumpX, int& jumpY) {
+                if (dx != 0 && dy != 0) {
+                    return jumpDiagonal(x, y, dx, dy, g, jumpX, jumpY);
+                }
+                return jumpStraight(x, y, dx, dy, g, jumpX, jumpY);
+            }
+
+            int successors(int /*x*/, int /*y*/, int dx, int dy, int directions[][2]) const {
+                int count = 0;
+                auto add = [&](int ddx, int ddy) {
+                    directions[count][0] = ddx;
+                    directions[count++][1] = ddy;
+                    };
+                if (dx != 0 && dy != 0) {
+                    add(dx, 0);
+                    add(0, dy);
+                    add(dx, dy);
+                }
+                else if (dx != 0) {
+                    add(dx, 0);
+                    add(0, -1);
+                    add(0, 1);
+                    add(dx, -1);
+                    add(dx, 1);
+                }
+                else {
+                    add(0, dy);
+                    add(-1, 0);
+                    add(1, 0);
+                    add(-1, dy);
+                    add(1, dy);
+                }
+                return count;
+            }
+
+            static int edgeCost(int dx, int dy) {
+                int straight = abs(abs(dx) - abs(dy));
+                int diagonal = min(abs(dx), abs(dy));
+                return Neighbourhood::straightCost * straight + Neighbourhood::diagonalCost * diagonal;
+            }
+        };
+
+    }
+
+    template <typename Scanner, typename Heuristic, typename OpenList>
+    static pair<int, vector<pair<int, int>>> jumpPointSearchWith(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, SearchStats& counters) {
+        using Neighbourhood = typename Scanner::Neighbourhood;
+        int width = map.getWidth();
+        int height = map.getHeight();
+        const Heuristic calculateHeuristic{ goalX, goalY };
+
+        Grid<int> gScore(width, height, INT_MAX, map.getLayout());
+        vector<uint32_t> parent(gScore.size());
+        Scanner scanner{ { map, goalX, goalY, visited } };
+
+        size_t start = map.index(startX, startY);
+        gScore.at(start) = 0;
+        visited.at(start) = 0;
+        parent[start] = static_cast<uint32_t>(start);
+
+        OpenList openSet(gScore.size());
+        int startH = calculateHeuristic(startX, startY);
+        openSet.pushOrDecrease(static_cast<uint32_t>(start), startH, startH, counters);
+
+        vector<pair<int, int>> path;
+
+        while (!openSet.empty()) {
+            size_t current = openSet.popMin();
+            counters.expansions++;
+            int x = map.indexToX(current), y = map.indexToY(current);
+            int g = gScore.at(current);
+
+            if (x == goalX && y == goalY) {
+                // Gerade bzw. diagonale Stuecke zwischen den Sprungpunkten wieder auffuellen
+                size_t node = current;
+                while (node != start) {
+                    size_t previous = parent[node];
+                    int cx = map.indexToX(node), cy = map.indexToY(node);
+                    int px = map.indexToX(previous), py = map.indexToY(previous);
+                    int dx = sign(px - cx), dy = sign(py - cy);
+                    while (cx != px || cy != py) {
+                        path.push_back({ cy, cx });
+                        cx += dx;
+                        cy += dy;
+                    }
+                    node = previous;
+                }
+                path.push_back({ startY, startX });
+                reverse(path.begin(), path.end());
+                return { g, path };
+            }
+
+            // Suchrichtungen (dx, dy): am Start alle, sonst nach den Regeln des Scanners
+            int directions[Neighbourhood::count][2];
+            int count = 0;
+            if (current == start) {
+                for (int d = 0; d < Neighbourhood::count; d++) {
+                    directions[count][0] = Neighbourhood::dx[d];
+                    directions[count++][1] = Neighbourhood::dy[d];
+                }
+            }
+            else {
+                int px = map.indexToX(parent[current]), py = map.indexToY(parent[current]);
+                count = scanner.successors(x, y, sign(x - px), sign(y - py), directions);
+            }
+
+            for (int d = 0; d < count; d++) {
+                int jx, jy;
+                if (!scanner.jump(x, y, directions[d][0], directions[d][1], g, jx, jy)) {
+                    continue;
+                }
+                size_t next = map.index(jx, jy);
+                if (openSet.isClosed(static_cast<uint32_t>(next))) {
+                    continue;
+                }
+                int tentative = g + Scanner::edgeCost(jx - x, jy - y);
+                if (tentative < gScore.at(next)) {
+                    gScore.at(next) = tentative;
+                    parent[next] = static_cast<uint32_t>(current);
+                    int h = calculateHeuristic(jx, jy);
+                    openSet.pushOrDecrease(static_cast<uint32_t>(next), tentative + h, h, counters);
+                }
+            }
+        }
+
+        return { -1, path };
+    }
+
+    template <typename Scanner, typename OpenList>
+    static pair<int, vector<pair<int, int>>> jumpPointSearchWithOpenList(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, SearchStats& counters) {
+        using Neighbourhood = typename Scanner::Neighbourhood;
+        if (heuristic == HeuristicKind::Airplane) {
+            return jumpPointSearchWith<Scanner, AirplaneHeuristic<Neighbourhood>, OpenList>(map, startX, startY, goalX, goalY, visited, counters);
+        }
+        if (heuristic == HeuristicKind::Octile) {
+            return jumpPointSearchWith<Scanner, OctileHeuristic<Neighbourhood>, OpenList>(map, startX, startY, goalX, goalY, visited, counters);
+        }
+        return jumpPointSearchWith<Scanner, ManhattanHeuristic<Neighbourhood>, OpenList>(map, startX, startY, goalX, goalY, visited, counters);
+    }
+
+    template <typename Scanner>
+    static pair<int, vector<pair<int, int>>> jumpPointSearchWithScanner(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, SearchStats& counters, OpenListKind openList) {
+        if (openList == OpenListKind::Bucket) {
+            return jumpPointSearchWithOpenList<Scanner, BucketQueue>(map, startX, startY, goalX, goalY, visited, heuristic, counters);
+        }
+        if (openList == OpenListKind::Radix) {
+            return jumpPointSearchWithOpenList<Scanner, RadixHeap>(map, startX, startY, goalX, goalY, visited, heuristic, counters);
+        }
+        return jumpPointSearchWithOpenList<Scanner, DaryHeap<4>>(map, startX, startY, goalX, goalY, visited, heuristic, counters);
+    }
+
+    pair<int, vector<pair<int, int>>> jumpPointSearch(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats, OpenListKind openList, int connectivity) {
+        SearchStats localStats;
+        SearchStats& counters = stats != nullptr ? *stats : localStats;
+        if (connectivity == 8) {
+            return jumpPointSearchWithScanner<DiagonalJumpScanner>(map, startX, startY, goalX, goalY, visited, heuristic,
+                counters, openList);
+        }
+        return jumpPointSearchWithScanner<JumpScanner>(map, startX, startY, goalX, goalY, visited, heuristic, counters, openList);
+    }
+
+}
@@ -0,0 +1,195 @@
+#include "Landmarks.h"
+#include <climits>
+#include <cmath>
+#include <random>
+#include "Planners.h"
+#include "SearchWorkspace.h"
+
+using namespace std;
+
+namespace gridplan {
+
+    // Entfernungen von node zu allen erreichbaren Feldern. Das Ziel liegt ausserhalb der Karte,
+    // Wavefront bzw. Dijkstra fluten also die ganze Zusammenhangskomponente; danach enthaelt
+    // workspace.touched genau die erreichten Felder. visited wird nur beschrieben.
+    static const Grid<int>& flood(const Map& map, size_t node, int connectivity, SearchWorkspace& workspace,
+        Grid<int>& visited) {
+        int x = map.indexToX(node), y = map.indexToY(node);
+        if (connectivity == 8) {
+            aStar(map, x, y, -1, -1, visited, HeuristicKind::Zero, nullptr, OpenListKind::Radix, 8, nullptr, &workspace);
+            return workspace.gScore();
+        }
+        wavefront(map, x, y, -1, -1, visited, 4, &workspace);
+        return workspace.distance();
+    }
+
+    Landmarks::Landmarks(const Map& map, int count, LandmarkSelection selection, int connectivity, unsigned seed)
+        : width(map.getWidth()), height(map.getHeight()), layout(map.getLayout()),
+          connectivity(normalizeConnectivity(connectivity)), selection(selection) {
+        vector<uint32_t> freeCells;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                if (!map.isObstacle(x, y)) {
+                    freeCells.push_back(static_cast<uint32_t>(map.index(x, y)));
+                }
+            }
+        }
+        size_t stride = static_cast<size_t>(max(1, min(count, MAX_LANDMARKS)));
+        stride = min(stride, freeCells.size());
+        if (stride == 0) {
+            return;  // keine freien Felder, keine Landmarken
+        }
+
+        // Tabellen mit stride Eintraegen je Feld; erst 16 Bit, bei der ersten zu grossen
+        // Entfernung werden sie auf 32 Bit umgestellt
+        size_t cells = Grid<int>::storageSize(width, height, layout);
+        narrow.assign(cells * stride, NARROW_UNREACHABLE);
+        vector<int> nearest(cells, -1);     // kleinste Entfernung zu einer Landmarke, -1 = nicht erreicht
+        SearchWorkspace workspace(map);
+        Grid<int> visited(width, height, -1, layout);
+
+        auto addLandmark = [&](uint32_t node) {
+            size_t i = positions.size();
+            positions.push_back({ map.indexToX(node), map.indexToY(node) });
+            const Grid<int>& distance = flood(map, node, this->connectivity, workspace, visited);
+            // In Speicherreihenfolge statt in der Reihenfolge der Suche: die Zeilen der Tabelle
+            // werden so nacheinander beschrieben. Nicht erreicht: -1 (Wavefront) bzw. INT_MAX (Dijkstra).
+            for (size_t cell = 0; cell < cells; cell++) {
+                int d = distance.at(cell);
+                if (d < 0 || d == INT_MAX) {
+                    continue;
+                }
+                if (wide.empty() && d >= NARROW_UNREACHABLE) {
+                    wide.assign(cells * stride, WIDE_UNREACHABLE);
+                    for (size_t entry = 0; entry < narrow.size(); entry++) {
+                        if (narrow[entry] != NARROW_UNREACHABLE) {
+                            wide[entry] = narrow[entry];
+                        }
+                    }
+                    vector<uint16_t>().swap(narrow);
+                }
+                if (wide.empty()) {
+                    narrow[cell * stride + i] = static_cast<uint16_t>(d);
+                }
+                else {
+                    wide[cell * stride + i] = static_cast<uint32_t>(d);
+                }
+                if (nearest[cell] < 0 || d < nearest[cell]) {
+                    nearest[cell] = d;
+                }
+            }
+        };
+
+        // Ausgangsfeld fuer farthest und planar: der Start, sonst das freie Feld nahe der Mitte
+        uint32_t origin = freeCells.front();
+        if (map.hasStart()) {
+            origin = static_cast<uint32_t>(map.index(map.getStart().first, map.getStart().second));
+        }
+        else {
+            long long bestSquare = -1;
+            for (uint32_t node : freeCells) {
+                long long dx = 2 * map.indexToX(node) - width, dy = 2 * map.indexToY(node) - height;
+                if (bestSquare < 0 || dx * dx + dy * dy < bestSquare) {
+                    bestSquare = dx * dx + dy * dy;
+                    origin = node;
+                }
+            }
+        }
+
+        if (selection == LandmarkSelection::Random) {
+            // Teilweises Mischen: die ersten stride Felder sind verschieden und gleichverteilt
+            mt19937 rng(seed);
+            for (size_t i = 0; i < stride; i++) {
+                size_t j = i + rng() % (freeCells.size() - i);
+                swap(freeCells[i], freeCells[j]);
+                addLandmark(freeCells[i]);
+            }
+        }
+        else {
+            const Grid<int>& fromOrigin = flood(map, origin, this->connectivity, workspace, visited);
+            if (selection == LandmarkSelection::Planar) {
+                // Je Winkelsektor um das Ausgangsfeld das Feld mit der groessten Entfernung
+                int ox = map.indexToX(origin), oy = map.indexToY(origin);
+                vector<uint32_t> best(stride, origin);
+                vector<int> bestDistance(stride, 0);
+                const double pi = acos(-1.0);
+                for (uint32_t reached : workspace.touched) {
+                    double angle = atan2(map.indexToY(reached) - oy, map.indexToX(reached) - ox);
+                    size_t sector = min(stride - 1, static_cast<size_t>((angle + pi) / (2 * pi) * stride));
+                    if (fromOrigin.at(reached) > bestDistance[sector]) {
+                        bestDistance[sector] = fromOrigin.at(reached);
+                        best[sector] = reached;
+                    }
+                }
+                for (size_t sector = 0; sector < stride; sector++) {
+                    if (bestDistance[sector] > 0) {
+                        addLandmark(best[sector]);
+                    }
+                }
+            }
+            else {
+                // Erste Landmarke: das vom Ausgangsfeld am weitesten entfernte Feld
+                uint32_t farthest = origin;
+                for (uint32_t reached : workspace.touched) {
+                    if (fromOrigin.at(reached) > fromOrigin.at(farthest)) {
+                        farthest = reached;
+                    }
+                }
+                addLandmark(farthest);
+            }
+            // Weitere (bei planar fuer leere Sektoren): groesste Entfernung zur naechsten Landmarke
+            while (positions.size() < stride) {
+                size_t farthest = 0;
+                for (size_t node = 1; node < cells; node++) {
+                    if (nearest[node] > nearest[farthest]) {
+                        farthest = node;
+                    }
+                }
+                if (nearest[farthest] <= 0) {
+                    break;  // alle erreichbaren Felder sind schon Landmarken
+                }
+                addLandmark(static_cast<uint32_t>(farthest));
+            }
+        }
+
+        // Weniger Landmarken als geplant (kleine Zusammenhangskomponente): dichter packen
+        if (positions.size() < stride) {
+            repack(stride, cells);
+        }
+    }
+
+    template <typename Distance>
+    static void packRows(vector<Distance>& table, size_t stride, size_t k, size_t cells) {
+        for (size_t node = 0; node < cells; node++) {
+            for (size_t i = 0; i < k; i++) {
+                table[node * k + i] = table[node * stride + i];  // node * k <= node * stride
+            }
+        }
+        table.resize(cells * k);
+        table.shrink_to_fit();
+    }
+
+    void Landmarks::repack(size_t stride, size_t cells) {
+        if (wide.empty()) {
+            packRows(narrow, stride, positions.size(), cells);
+        }
+        else {
+            packRows(wide, stride, positions.size(), cells);
+        }
+    }
+
+    void Landmarks::distances(size_t node, int* out) const {
+        size_t k = positions.size();
+        for (size_t i = 0; i < k; i++) {
+            if (wide.empty()) {
+                uint16_t d = narrow[node * k + i];
+                out[i] = d == NARROW_UNREACHABLE ? -1 : d;
+            }
+            else {
+                uint32_t d = wide[node * k + i];
+                out[i] = d == WIDE_UNREACHABLE ? -1 : static_cast<int>(d);
+            }
+        }
+    }
+
+}
@@ -0,0 +1,136 @@
+#ifndef GRIDPLAN_LANDMARKS_H
+#define GRIDPLAN_LANDMARKS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Map.h"
+#include "SearchPolicies.h"
+
+namespace gridplan {
+
+    // Auswahl der Landmarken (Kommandozeile --landmark-selection):
+    // random   = zufaellige freie Felder,
+    // farthest = nacheinander das Feld mit der groessten Entfernung zu allen bisherigen,
+    // planar   = je Winkelsektor um die Kartenmitte das am weitesten entfernte Feld
+    enum class LandmarkSelection { Random, Farthest, Planar };
+
+    // "random", "farthest" bzw. "planar"; false bei unbekanntem Namen
+    inline bool parseLandmarkSelection(const std::string& name, LandmarkSelection& selection) {
+        if (name == "random") {
+            selection = LandmarkSelection::Random;
+            return true;
+        }
+        if (name == "farthest") {
+            selection = LandmarkSelection::Farthest;
+            return true;
+        }
+        if (name == "planar") {
+            selection = LandmarkSelection::Planar;
+            return true;
+        }
+        return false;
+    }
+
+    inline const char* landmarkSelectionName(LandmarkSelection selection) {
+        switch (selection) {
+        case LandmarkSelection::Random: return "random";
+        case LandmarkSelection::Planar: return "planar";
+        default: return "farthest";
+        }
+    }
+
+    const int MAX_LANDMARKS = 32;
+
+    // Landmarken-Heuristik (ALT: A*, Landmarken, Dreiecksungleichung). Von K Landmarken L
+    // aus wird einmal die Entfernung zu jedem Feld berechnet; fuer jedes Feld n und Ziel g gilt
+    // dann d(n, g) >= |d(L, g) - d(L, n)|, das Maximum ueber alle Landmarken ist eine zulaessige
+    // und konsistente Heuristik, die im Gegensatz zu Manhattan und Luftlinie Waende kennt.
+    // 4er-Nachbarschaft: Breitensuche mit dem Wavefront-Kern, 8er-Nachbarschaft: Dijkstra mit
+    // dem A*-Kern (Kosten 70/99). Die Tabellen liegen je Feld hintereinander (K Eintraege) mit
+    // 16 Bit je Entfernung, nur wenn eine Entfernung nicht hineinpasst mit 32 Bit.
+    // Felder, die von einer Landmarke aus nicht erreichbar sind, liefern fuer sie keine Schranke.
+    class Landmarks {
+    public:
+        // Waehlt count Landmarken (1..MAX_LANDMARKS, hoechstens so viele wie freie Felder)
+        // und berechnet ihre Tabellen. farthest und planar gehen vom Start der Karte aus (ohne
+        // Start vom freien Feld nahe der Mitte), random verwendet seed.
+        Landmarks(const Map& map, int count = 8, LandmarkSelection selection = LandmarkSelection::Farthest,
+            int connectivity = 4, unsigned seed = 1);
+
+        // Entfernungen aller Landmarken zu node (Map::index) in Kosteneinheiten der
+        // Nachbarschaft, -1 = nicht erreichbar; out hat Platz fuer getCount() Werte
+        void distances(size_t node, int* out) const;
+
+        // max |goalDistance[i] - d(L_i, node)| ueber alle Landmarken mit beiden Entfernungen,
+        // goalDistance wie von distances() fuer das Ziel
+        int lowerBound(size_t node, const int* goalDistance) const {
+            if (wide.empty()) {
+                return bound(narrow.data() + node * positions.size(), goalDistance, NARROW_UNREACHABLE);
+            }
+            return bound(wide.data() + node * positions.size(), goalDistance, WIDE_UNREACHABLE);
+        }
+
+        // Passen die Tabellen zu Karte (Groesse, Anordnung) und Nachbarschaft?
+        bool matches(const Map& map, int connectivity) const {
+            return map.getWidth() == width && map.getHeight() == height && map.getLayout() == layout
+                && normalizeConnectivity(connectivity) == this->connectivity;
+        }
+
+        int getCount() const { return static_cast<int>(positions.size()); }
+        int getConnectivity() const { return connectivity; }
+        LandmarkSelection getSelection() const { return selection; }
+        const std::vector<std::pair<int, int>>& getPositions() const { return positions; }  // (x, y)
+        size_t getTableBytes() const { return narrow.size() * sizeof(uint16_t) + wide.size() * sizeof(uint32_t); }
+
+    private:
+        static constexpr uint16_t NARROW_UNREACHABLE = 0xFFFF;
+        static constexpr uint32_t WIDE_UNREACHABLE = 0xFFFFFFFF;
+
+        void repack(size_t stride, size_t cells);
+
+        template <typename Distance>
+        int bound(const Distance* row, const int* goalDistance, Distance unreachable) const {
+            int best = 0;
+            for (size_t i = 0; i < positions.size(); i++) {
+                if (row[i] != unreachable && goalDistance[i] >= 0) {
+                    best = std::max(best, std::abs(goalDistance[i] - static_cast<int>(row[i])));
+                }
+            }
+            return best;
+        }
+
+        int width, height;
+        GridLayout layout;
+        int connectivity;
+        LandmarkSelection selection;
+        std::vector<std::pair<int, int>> positions;
+        std::vector<uint16_t> narrow;       // storageSize * K Eintraege, wenn wide leer ist
+        std::vector<uint32_t> wide;         // nur wenn eine Entfernung >= NARROW_UNREACHABLE ist
+    };
+
+    // Heuristik der A*-Kerne (SearchPolicies.h) mit Landmarken: Maximum aus Oktil-Abstand
+    // und Landmarkenschranke. Die Entfernungen des Ziels werden einmal je Suche gelesen.
+    template <typename Neighbourhood>
+    struct LandmarkHeuristic {
+        const Map& map;
+        const Landmarks& landmarks;
+        OctileHeuristic<Neighbourhood> octile;
+        int goalDistance[MAX_LANDMARKS];
+
+        LandmarkHeuristic(const Map& map, const Landmarks& landmarks, int goalX, int goalY)
+            : map(map), landmarks(landmarks), octile{ goalX, goalY } {
+            landmarks.distances(map.index(goalX, goalY), goalDistance);
+        }
+
+        int operator()(int x, int y) const {
+            return std::max(octile(x, y), landmarks.lowerBound(map.index(x, y), goalDistance));
+        }
+    };
+
+}
+
+#endif
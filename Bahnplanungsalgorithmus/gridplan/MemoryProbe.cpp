@@ -0,0 +1,130 @@
+#include "MemoryProbe.h"
+#include <atomic>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
+#else
+#include <cstdio>
+#include <cstring>
+#include <sys/resource.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+#endif
+
+namespace gridplan {
+
+    // Wird nur von Cpp_Algorithms/AllocationCounter.cpp erhoeht
+    static std::atomic<uint64_t> allocationCounter(0);
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+    // Liest einen Wert in kB (z. B. "VmRSS:") aus /proc/self/status, 0 wenn nicht vorhanden
+    static size_t readProcStatus(const char* key) {
+        FILE* status = fopen("/proc/self/status", "r");
+        if (status == nullptr) {
+            return 0;
+        }
+        char line[256];
+        size_t keyLength = strlen(key);
+        size_t value = 0;
+        while (fgets(line, sizeof(line), status) != nullptr) {
+            if (strncmp(line, key, keyLength) == 0) {
+                unsigned long long kb = 0;
+                if (sscanf(line + keyLength, "%llu", &kb) == 1) {
+                    value = static_cast<size_t>(kb) * 1024;
+                }
+                break;
+            }
+        }
+        fclose(status);
+        return value;
+    }
+#endif
+
+    size_t currentRss() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS_EX pmc;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
+            return pmc.WorkingSetSize;
+        }
+        return 0;
+#elif defined(__APPLE__)
+        mach_task_basic_info info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS) {
+            return info.resident_size;
+        }
+        return 0;
+#else
+        return readProcStatus("VmRSS:");
+#endif
+    }
+
+    size_t peakRss() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS_EX pmc;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
+            return pmc.PeakWorkingSetSize;
+        }
+        return 0;
+#else
+#ifndef __APPLE__
+        size_t hwm = readProcStatus("VmHWM:");
+        if (hwm != 0) {
+            return hwm;
+        }
+#endif
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+#ifdef __APPLE__
+        return static_cast<size_t>(usage.ru_maxrss);          // Bytes
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;   // kB
+#endif
+#endif
+    }
+
+    float getMemoryUsage() {
+        return currentRss() / (1024.0f * 1024.0f);  // Umrechnung in MB
+    }
+
+    void countAllocation(size_t bytes) {
+        allocationCounter.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    uint64_t allocatedBytes() {
+        return allocationCounter.load(std::memory_order_relaxed);
+    }
+
+    void MemoryProbe::start() {
+#if !defined(_WIN32) && !defined(__APPLE__)
+        // "5" setzt VmHWM auf den aktuellen RSS zurueck (Linux >= 4.0); Fehler werden ignoriert
+        FILE* clearRefs = fopen("/proc/self/clear_refs", "w");
+        if (clearRefs != nullptr) {
+            fputs("5", clearRefs);
+            fclose(clearRefs);
+        }
+#endif
+        usageBefore = getMemoryUsage();
+        allocatedBefore = allocatedBytes();
+    }
+
+    MemoryStats MemoryProbe::stop() {
+        MemoryStats stats;
+        stats.allocated = allocatedBytes() - allocatedBefore;
+        stats.rss = currentRss();
+        stats.peakRss = peakRss();
+        stats.usageDelta = stats.rss / (1024.0f * 1024.0f) - usageBefore;
+        return stats;
+    }
+
+}
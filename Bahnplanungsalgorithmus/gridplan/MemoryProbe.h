@@ -0,0 +1,47 @@
+#ifndef GRIDPLAN_MEMORYPROBE_H
+#define GRIDPLAN_MEMORYPROBE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gridplan {
+
+    // Arbeitsspeicher (Working Set bzw. RSS) des aktuellen Prozesses in MB, 0 bei Fehlern
+    float getMemoryUsage();
+
+    // Aktueller und hoechster residenter Speicher des Prozesses in Bytes (0, wenn nicht
+    // ermittelbar). Quellen: Windows GetProcessMemoryInfo, Linux /proc/self/status
+    // (VmRSS, VmHWM), sonst getrusage (nur Spitzenwert).
+    size_t currentRss();
+    size_t peakRss();
+
+    // Summe aller ueber operator new angeforderten Bytes seit Programmstart. Gezaehlt wird
+    // nur in Programmen, die Cpp_Algorithms/AllocationCounter.cpp mitkompilieren (ersetzter
+    // globaler operator new, ruft countAllocation auf); sonst immer 0.
+    uint64_t allocatedBytes();
+    void countAllocation(size_t bytes);
+
+    // Speicherkennzahlen eines Messfensters, siehe MemoryProbe
+    struct MemoryStats {
+        size_t rss = 0;             // RSS am Ende des Fensters
+        size_t peakRss = 0;         // hoechster RSS (im Fenster, falls zuruecksetzbar, sonst seit Programmstart)
+        uint64_t allocated = 0;     // im Fenster angeforderte Bytes (0 ohne AllocationCounter.cpp)
+        float usageDelta = 0;       // RSS-Zuwachs in MB (bisheriges memory_usage)
+    };
+
+    // Misst ein Fenster (z. B. die Suche): start() vor, stop() nach dem Abschnitt.
+    // Unter Linux wird der Spitzenwert VmHWM bei start() ueber /proc/self/clear_refs
+    // zurueckgesetzt, so dass peakRss nur das Fenster betrifft.
+    class MemoryProbe {
+    public:
+        void start();
+        MemoryStats stop();
+
+    private:
+        float usageBefore = 0;
+        uint64_t allocatedBefore = 0;
+    };
+
+}
+
+#endif
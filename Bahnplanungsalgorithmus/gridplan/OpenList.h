@@ -0,0 +1,337 @@
+#ifndef GRIDPLAN_OPENLIST_H
+#define GRIDPLAN_OPENLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../BitOps.h"
+
+namespace gridplan {
+
+    // Zaehler einer Suche (z. B. A*), in der JSON als "expansions" usw.
+    struct SearchStats {
+        long long expansions = 0;       // aus der offenen Liste entnommene Knoten
+        long long pushes = 0;           // neu in die offene Liste eingefuegte Knoten
+        long long decreaseKeys = 0;     // Schluessel eines offenen Knotens gesenkt
+    };
+
+    // Auswahl der offenen Liste fuer A* (Kommandozeile: heap, bucket oder radix)
+    enum class OpenListKind { Heap, Bucket, Radix };
+
+    // "heap", "bucket" bzw. "radix"; false bei unbekanntem Namen
+    inline bool parseOpenListKind(const std::string& name, OpenListKind& kind) {
+        if (name == "heap") {
+            kind = OpenListKind::Heap;
+            return true;
+        }
+        if (name == "bucket") {
+            kind = OpenListKind::Bucket;
+            return true;
+        }
+        if (name == "radix") {
+            kind = OpenListKind::Radix;
+            return true;
+        }
+        return false;
+    }
+
+    inline const char* openListName(OpenListKind kind) {
+        switch (kind) {
+        case OpenListKind::Bucket:
+            return "bucket";
+        case OpenListKind::Radix:
+            return "radix";
+        default:
+            return "heap";
+        }
+    }
+
+    // Alle offenen Listen haben dieselbe Schnittstelle: pushOrDecrease(node, f, h, stats),
+    // popMin(), empty(), isClosed(node). Knoten sind lineare Indizes (Map::index).
+    // clear(touched) leert die Liste fuer die naechste Suche und setzt nur die Knoten in
+    // touched zurueck; alle anderen muessen unberuehrt sein (SearchWorkspace).
+
+    // Offene Liste fuer A*: indizierter d-aerer Min-Heap ueber Knotenindizes (Map::index).
+    // Jeder Eintrag traegt seinen Schluessel selbst, der Heap haengt also nicht mehr an
+    // einer veraenderlichen fScore-Matrix. position[node] haelt die Stelle im Heap, damit
+    // ein Knoten nur einmal enthalten ist und sein Schluessel gesenkt werden kann;
+    // entnommene Knoten werden als geschlossen markiert.
+    template <int D = 4>
+    class DaryHeap {
+    public:
+        explicit DaryHeap(size_t nodeCount) : position(nodeCount, NOT_SEEN) {}
+
+        bool empty() const { return heap.empty(); }
+        size_t size() const { return heap.size(); }
+        bool isOpen(uint32_t node) const { return position[node] >= 0; }
+        bool isClosed(uint32_t node) const { return position[node] == CLOSED; }
+
+        // Kleinstes f in der Liste (nur wenn nicht leer)
+        int minF() const { return static_cast<int>(heap.front().key >> 32); }
+
+        // Fuegt node ein oder senkt den Schluessel, falls node schon offen ist und (f, h) kleiner.
+        // Geschlossene Knoten werden wieder geoeffnet. Bei gleichem f gewinnt das kleinere h.
+        void pushOrDecrease(uint32_t node, int f, int h, SearchStats& stats) {
+            uint64_t key = (static_cast<uint64_t>(f) << 32) | static_cast<uint32_t>(h);
+            int32_t pos = position[node];
+            if (pos >= 0) {
+                if (key < heap[pos].key) {
+                    heap[pos].key = key;
+                    siftUp(pos);
+                    stats.decreaseKeys++;
+                }
+                return;
+            }
+            heap.push_back({ key, node });
+            siftUp(static_cast<int32_t>(heap.size() - 1));
+            stats.pushes++;
+        }
+
+        // Entnimmt den Knoten mit dem kleinsten Schluessel und schliesst ihn
+        uint32_t popMin() {
+            uint32_t node = heap.front().node;
+            position[node] = CLOSED;
+            Entry last = heap.back();
+            heap.pop_back();
+            if (!heap.empty()) {
+                siftDown(0, last);
+            }
+            return node;
+        }
+
+        void clear(const std::vector<uint32_t>& touched) {
+            heap.clear();
+            for (uint32_t node : touched) {
+                position[node] = NOT_SEEN;
+            }
+        }
+
+    private:
+        static constexpr int32_t NOT_SEEN = -1;
+        static constexpr int32_t CLOSED = -2;
+
+        struct Entry {
+            uint64_t key;
+            uint32_t node;
+        };
+
+        // Loch-Verfahren: Eltern nach unten schieben, Eintrag einmal schreiben
+        void siftUp(int32_t pos) {
+            Entry entry = heap[pos];
+            while (pos > 0) {
+                int32_t parent = (pos - 1) / D;
+                if (heap[parent].key <= entry.key) {
+                    break;
+                }
+                place(pos, heap[parent]);
+                pos = parent;
+            }
+            place(pos, entry);
+        }
+
+        void siftDown(int32_t pos, Entry entry) {
+            int32_t count = static_cast<int32_t>(heap.size());
+            while (true) {
+                int32_t first = pos * D + 1;
+                if (first >= count) {
+                    break;
+                }
+                int32_t last = first + D < count ? first + D : count;
+                int32_t best = first;
+                for (int32_t child = first + 1; child < last; child++) {
+                    if (heap[child].key < heap[best].key) {
+                        best = child;
+                    }
+                }
+                if (entry.key <= heap[best].key) {
+                    break;
+                }
+                place(pos, heap[best]);
+                pos = best;
+            }
+            place(pos, entry);
+        }
+
+        void place(int32_t pos, const Entry& entry) {
+            heap[pos] = entry;
+            position[entry.node] = pos;
+        }
+
+        std::vector<Entry> heap;
+        std::vector<int32_t> position;  // Stelle im Heap, NOT_SEEN oder CLOSED
+    };
+
+    // Offene Liste nach Dial: ein Eimer pro ganzzahligem f-Wert, push und pop-min in O(1).
+    // Mit konsistenter Heuristik und Kosten 1 steigt das kleinste f nur an, der Zeiger auf
+    // den ersten nichtleeren Eimer laeuft also nur vorwaerts. Gesenkte Schluessel werden
+    // erneut eingefuegt (lazy deletion), veraltete Eintraege beim Entnehmen uebersprungen.
+    // Innerhalb eines Eimers wird der zuletzt eingefuegte Knoten zuerst entnommen, was wie
+    // der h-Vergleich des Heaps tiefere Knoten bevorzugt. Die Eimer reichen bis zum groessten
+    // f-Wert, die Liste taugt also nur fuer kleine Schluessel; runAStar und runDijkstra lehnen
+    // sie mit Gelaendekosten ab (Status 401).
+    class BucketQueue {
+    public:
+        explicit BucketQueue(size_t nodeCount) : state(nodeCount, NOT_SEEN) {}
+
+        bool empty() const { return openCount == 0; }
+        bool isOpen(uint32_t node) const { return state[node] == OPEN; }
+        bool isClosed(uint32_t node) const { return state[node] == CLOSED; }
+
+        void pushOrDecrease(uint32_t node, int f, int /*h*/, SearchStats& stats) {
+            if (state[node] == OPEN) {
+                stats.decreaseKeys++;
+            }
+            else {
+                state[node] = OPEN;
+                openCount++;
+                stats.pushes++;
+            }
+            size_t bucket = static_cast<size_t>(f);
+            if (bucket >= buckets.size()) {
+                buckets.resize(bucket + 1);
+            }
+            if (bucket < current) {
+                current = bucket;  // nur bei inkonsistenter Heuristik
+            }
+            buckets[bucket].push_back(node);
+        }
+
+        uint32_t popMin() {
+            while (true) {
+                while (buckets[current].empty()) {
+                    current++;
+                }
+                uint32_t node = buckets[current].back();
+                buckets[current].pop_back();
+                if (state[node] == OPEN) {
+                    state[node] = CLOSED;
+                    openCount--;
+                    return node;
+                }
+                // veralteter Eintrag eines schon entnommenen Knotens
+            }
+        }
+
+        void clear(const std::vector<uint32_t>& touched) {
+            for (std::vector<uint32_t>& bucket : buckets) {
+                bucket.clear();
+            }
+            for (uint32_t node : touched) {
+                state[node] = NOT_SEEN;
+            }
+            current = 0;
+            openCount = 0;
+        }
+
+    private:
+        static constexpr uint8_t NOT_SEEN = 0;
+        static constexpr uint8_t OPEN = 1;
+        static constexpr uint8_t CLOSED = 2;
+
+        std::vector<std::vector<uint32_t>> buckets;  // Index = f
+        std::vector<uint8_t> state;
+        size_t current = 0;                          // kleinster moeglicherweise belegter Eimer
+        size_t openCount = 0;
+    };
+
+    // Radix-Heap fuer monotone ganzzahlige Schluessel (Ahuja, Mehlhorn, Orlin, Tarjan).
+    // Eimer i > 0 haelt die Schluessel, die sich vom zuletzt entnommenen Minimum last
+    // zuerst im Bit i - 1 unterscheiden, Eimer 0 die Schluessel gleich last. Ist Eimer 0
+    // leer, wird der erste nichtleere Eimer um sein Minimum neu verteilt; jeder Eintrag
+    // wandert dabei nur abwaerts, hoechstens 32-mal. Anders als bei Dial kostet ein grosser
+    // Abstand zwischen den f-Werten (Gelaendekosten, 8er-Nachbarschaft) keine leeren Eimer.
+    // Setzt wie A* ohne Wiederoeffnen eine konsistente Heuristik voraus; veraltete
+    // Eintraege werden wie bei BucketQueue beim Entnehmen uebersprungen.
+    class RadixHeap {
+    public:
+        explicit RadixHeap(size_t nodeCount) : state(nodeCount, NOT_SEEN) {}
+
+        bool empty() const { return openCount == 0; }
+        bool isOpen(uint32_t node) const { return state[node] == OPEN; }
+        bool isClosed(uint32_t node) const { return state[node] == CLOSED; }
+
+        void pushOrDecrease(uint32_t node, int f, int /*h*/, SearchStats& stats) {
+            if (state[node] == OPEN) {
+                stats.decreaseKeys++;
+            }
+            else {
+                state[node] = OPEN;
+                openCount++;
+                stats.pushes++;
+            }
+            uint32_t key = static_cast<uint32_t>(f);
+            if (key < last) {
+                key = last;  // nur bei inkonsistenter Heuristik; Reihenfolge dann nicht mehr exakt
+            }
+            buckets[bucketFor(key)].push_back({ key, node });
+        }
+
+        uint32_t popMin() {
+            while (true) {
+                if (buckets[0].empty()) {
+                    redistribute();
+                }
+                uint32_t node = buckets[0].back().node;
+                buckets[0].pop_back();
+                if (state[node] == OPEN) {
+                    state[node] = CLOSED;
+                    openCount--;
+                    return node;
+                }
+                // veralteter Eintrag eines schon entnommenen Knotens
+            }
+        }
+
+        void clear(const std::vector<uint32_t>& touched) {
+            for (std::vector<Entry>& bucket : buckets) {
+                bucket.clear();
+            }
+            for (uint32_t node : touched) {
+                state[node] = NOT_SEEN;
+            }
+            last = 0;
+            openCount = 0;
+        }
+
+    private:
+        static constexpr uint8_t NOT_SEEN = 0;
+        static constexpr uint8_t OPEN = 1;
+        static constexpr uint8_t CLOSED = 2;
+        static constexpr int BUCKET_COUNT = 33;
+
+        struct Entry {
+            uint32_t key;
+            uint32_t node;
+        };
+
+        int bucketFor(uint32_t key) const {
+            return key == last ? 0 : 64 - countLeadingZeros(key ^ last);
+        }
+
+        // Erster nichtleerer Eimer: neues last = dessen Minimum, Eintraege neu einsortieren
+        void redistribute() {
+            int i = 1;
+            while (buckets[i].empty()) {
+                i++;
+            }
+            uint32_t minKey = buckets[i].front().key;
+            for (const Entry& entry : buckets[i]) {
+                minKey = entry.key < minKey ? entry.key : minKey;
+            }
+            last = minKey;
+            for (const Entry& entry : buckets[i]) {
+                buckets[bucketFor(entry.key)].push_back(entry);
+            }
+            buckets[i].clear();
+        }
+
+        std::vector<Entry> buckets[BUCKET_COUNT];
+        std::vector<uint8_t> state;
+        uint32_t last = 0;                           // zuletzt entnommenes Minimum
+        size_t openCount = 0;
+    };
+
+}
+
+#endif
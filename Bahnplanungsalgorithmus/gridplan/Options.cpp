@@ -0,0 +1,99 @@
+#include "Options.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace gridplan {
+
+    PlannerOptions parsePlannerOptions(int argc, char* argv[], int first) {
+        PlannerOptions options;
+        for (int i = first; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--layout" && i + 1 < argc) {
+                options.layout = std::string(argv[++i]) == "tiled" ? GridLayout::Tiled : GridLayout::RowMajor;
+            }
+            else if (arg == "--bidirectional") {
+                options.bidirectional = true;
+            }
+            else if (arg == "--threads" && i + 1 < argc) {
+                options.threads = std::max(0, std::atoi(argv[++i]));
+            }
+            else if (arg == "--kernel" && i + 1 < argc) {
+                parseBrushfireKernel(argv[++i], options.brushfireKernel);  // unbekannt: bfs bleibt
+            }
+            else if (arg == "--encoding" && i + 1 < argc) {
+                parseDistanceEncoding(argv[++i], options.distanceEncoding);  // unbekannt: squared bleibt
+            }
+            else if (arg == "--cluster-size" && i + 1 < argc) {
+                options.clusterSize = std::max(2, std::atoi(argv[++i]));
+            }
+            else if (arg == "--landmarks" && i + 1 < argc) {
+                options.landmarkCount = std::max(1, std::min(MAX_LANDMARKS, std::atoi(argv[++i])));
+            }
+            else if (arg == "--landmark-selection" && i + 1 < argc) {
+                parseLandmarkSelection(argv[++i], options.landmarkSelection);  // unbekannt: farthest bleibt
+            }
+            else if (arg == "--queries" && i + 1 < argc) {
+                options.queriesFile = argv[++i];
+            }
+            else if (arg == "--costs" && i + 1 < argc) {
+                options.costsFile = argv[++i];
+            }
+            else if (arg == "--connectivity" && i + 1 < argc) {
+                options.connectivity = normalizeConnectivity(std::atoi(argv[++i]));
+            }
+            else if (arg == "--repeat" && i + 1 < argc) {
+                options.repeat.repeat = std::max(1, std::atoi(argv[++i]));
+            }
+            else if (arg == "--warmup" && i + 1 < argc) {
+                options.repeat.warmup = std::max(0, std::atoi(argv[++i]));
+            }
+            else if (arg == "--precision" && i + 1 < argc) {
+                options.repeat.precision = std::atof(argv[++i]);
+            }
+            else if (arg == "--max-repeat" && i + 1 < argc) {
+                options.repeat.maxRepeat = std::max(0, std::atoi(argv[++i]));
+            }
+        }
+        return options;
+    }
+
+    bool parseAStarVariant(const std::string& arg, AStarOptions& options) {
+        if (arg == "jps") {
+            options.jumpPoints = true;
+            return true;
+        }
+        return parseOpenListKind(arg, options.openList);
+    }
+
+    bool loadMap(const std::string& filename, const PlannerOptions& options, Map& map) {
+        try {
+            map = Map::loadFromFile(filename, options.layout);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Fehler beim Einlesen der Karte: " << e.what() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool loadCosts(const std::string& filename, const Map& map, CostMap& costs) {
+        try {
+            costs = CostMap::loadFromFile(filename, map.getLayout());
+            if (costs.getLayout() != map.getLayout()) {
+                costs = costs.withLayout(map.getLayout());  // *.bcost in anderer Anordnung
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Fehler beim Einlesen der Kostenkarte: " << e.what() << std::endl;
+            return false;
+        }
+        if (!costs.matches(map)) {
+            std::cerr << "Kostenkarte " << costs.getWidth() << "x" << costs.getHeight() << " passt nicht zur Karte "
+                << map.getWidth() << "x" << map.getHeight() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,44 @@
+#ifndef GRIDPLAN_OPTIONS_H
+#define GRIDPLAN_OPTIONS_H
+
+#include <string>
+#include "../CostMap.h"
+#include "../Map.h"
+#include "Planners.h"
+#include "Timing.h"
+
+namespace gridplan {
+
+    // Optionale Argumente der Planer-Programme nach den Pflichtargumenten
+    struct PlannerOptions {
+        GridLayout layout = GridLayout::RowMajor;  // --layout tiled
+        RepeatOptions repeat;                      // --repeat N --warmup K --precision P --max-repeat M
+        bool bidirectional = false;                // --bidirectional (Wavefront, A*)
+        int connectivity = 4;                      // --connectivity 4|8 (alle Planer)
+        int threads = 1;                           // --threads N (Wavefront, Brushfire; 0 = alle Kerne)
+        BrushfireKernel brushfireKernel = BrushfireKernel::Bfs;  // --kernel bfs|chamfer|euclidean (Brushfire)
+        DistanceEncoding distanceEncoding = DistanceEncoding::Squared;  // --encoding squared|fixed (euclidean)
+        int clusterSize = 16;                      // --cluster-size N (HPA*, mindestens 2)
+        int landmarkCount = 8;                     // --landmarks K (A* landmarks, 1..MAX_LANDMARKS)
+        LandmarkSelection landmarkSelection = LandmarkSelection::Farthest;  // --landmark-selection random|farthest|planar
+        std::string queriesFile;                   // --queries Datei|- (Stapelbetrieb, - = Standardeingabe)
+        std::string costsFile;                     // --costs Datei (CSV oder *.bcost; Wavefront wird Dijkstra, A*)
+    };
+
+    // Liest die Optionen ab argv[first]; unbekannte Argumente werden ignoriert
+    PlannerOptions parsePlannerOptions(int argc, char* argv[], int first);
+
+    // Variante der A*-Suche: "heap", "bucket", "radix" (offene Liste) oder "jps"; false bei anderen Argumenten
+    bool parseAStarVariant(const std::string& arg, AStarOptions& options);
+
+    // Laedt die Karte (CSV oder *.bmap). Bei Fehlern wird die Meldung ausgegeben
+    // und false zurueckgegeben (Statuscode 500).
+    bool loadMap(const std::string& filename, const PlannerOptions& options, Map& map);
+
+    // Laedt die Gelaendekosten in der Speicheranordnung der Karte. Fehler (auch eine
+    // andere Groesse als die Karte) werden ausgegeben, Rueckgabe false (Statuscode 500).
+    bool loadCosts(const std::string& filename, const Map& map, CostMap& costs);
+
+}
+
+#endif
@@ -0,0 +1,305 @@
+#include "Planners.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "../BitOps.h"
+#include "Workers.h"
+
+using namespace std;
+
+// Ebenensynchrone Breitensuche mit mehreren Threads fuer Wavefront und Brushfire.
+//
+// Die Front einer Ebene ist die Verkettung der Listen aller Threads (Thread 0 zuerst);
+// jeder Thread bearbeitet einen gleich grossen, zusammenhaengenden Ausschnitt davon und
+// sammelt die neu erreichten Felder in seiner eigenen Liste. Zwischen den Ebenen warten
+// alle Threads an einer Barriere, so dass Entfernungen nur in einer Phase geschrieben
+// und in der naechsten gelesen werden.
+//
+// Brushfire flutet die ganze Karte; jede Entfernung ist eindeutig, der Besuch wird mit
+// einer atomaren Bitmap (fetch_or) vergeben. Wavefront bricht dagegen wie die serielle
+// Suche beim Ziel ab, die letzte Ebene haengt also von der Reihenfolge der Queue ab.
+// Deshalb bekommt dort jedes Feld den kleinsten Schluessel (Position in der Front,
+// Richtung), genau der Nachbar, der es auch in der seriellen Queue zuerst erreicht;
+// die Listen sind dann in Queue-Reihenfolge und werden hinter dem Ziel abgeschnitten.
+// algorithm_map und Pfad stimmen so Feld fuer Feld mit wavefront/brushfire ueberein.
+namespace gridplan {
+
+    namespace {
+
+        // Wiederverwendbare Barriere (C++17 hat noch kein std::barrier): kurz aktiv warten,
+        // danach die Zeitscheibe abgeben, damit mehr Threads als Kerne nicht blockieren
+        class LevelBarrier {
+        public:
+            explicit LevelBarrier(int count) : count(count) {}
+
+            void wait() {
+                int generation = phase.load(memory_order_acquire);
+                if (arrived.fetch_add(1, memory_order_acq_rel) + 1 == count) {
+                    arrived.store(0, memory_order_relaxed);
+                    phase.fetch_add(1, memory_order_release);
+                    return;
+                }
+                for (int spin = 0; phase.load(memory_order_acquire) == generation; spin++) {
+                    if (spin >= 64) {
+                        this_thread::yield();
+                    }
+                }
+            }
+
+        private:
+            const int count;
+            atomic<int> arrived{ 0 };
+            atomic<int> phase{ 0 };
+        };
+
+        // Front einer Ebene: eine Liste pro Thread
+        using Frontier = vector<vector<uint32_t>>;
+
+        // Anfangspositionen der Listen (offsets[threads] = Summe). Jeder Thread berechnet sie
+        // selbst, nachdem alle Listen der Ebene fertig sind, und haelt sie lokal.
+        void computeOffsets(const Frontier& lists, vector<size_t>& offsets) {
+            offsets.assign(lists.size() + 1, 0);
+            for (size_t t = 0; t < lists.size(); t++) {
+                offsets[t + 1] = offsets[t] + lists[t].size();
+            }
+        }
+
+        // f(i, node) fuer die globalen Positionen i in [begin, end)
+        template <typename F>
+        void forRange(const Frontier& lists, const vector<size_t>& offsets, size_t begin, size_t end, const F& f) {
+            size_t list = upper_bound(offsets.begin(), offsets.end(), begin) - offsets.begin() - 1;
+            for (size_t i = begin; i < end; list++) {
+                const vector<uint32_t>& nodes = lists[list];
+                size_t first = i - offsets[list];
+                size_t last = min(nodes.size(), end - offsets[list]);
+                for (size_t k = first; k < last; k++, i++) {
+                    f(i, nodes[k]);
+                }
+            }
+        }
+
+        using ClaimArray = unique_ptr<atomic<uint32_t>[]>;
+    }
+
+    int resolveThreadCount(int threads) {
+        if (threads > 0) {
+            return threads;
+        }
+        unsigned hardware = thread::hardware_concurrency();
+        return hardware > 0 ? static_cast<int>(hardware) : 1;
+    }
+
+    template <typename Neighbourhood>
+    static pair<int, vector<pair<int, int>>> wavefrontParallelSearch(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, int threads) {
+        const size_t count = map.size();
+        const size_t start = map.index(startX, startY);
+        const size_t goal = map.index(goalX, goalY);
+        Grid<int> distance(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        distance.at(start) = 0;
+        visited.at(start) = 0;
+
+        // Anspruch je Feld: UINT32_MAX - (Position * count + Richtung), 0 = frei; das Maximum
+        // gehoert dem Nachbarn, der das Feld in der seriellen Queue zuerst erreicht
+        ClaimArray claim(new atomic<uint32_t>[count]);
+        Frontier frontiers[2] = { Frontier(threads), Frontier(threads) };
+        frontiers[0][0].push_back(static_cast<uint32_t>(start));
+        vector<size_t> goalPosition(threads, SIZE_MAX);  // Stelle des Ziels in der Liste eines Threads
+        LevelBarrier barrier(threads);
+        size_t cut = SIZE_MAX;                            // Ebene beim Ziel: Felder ab hier nicht eintragen
+
+        runWorkers(threads, [&](int t) {
+            for (size_t i = sliceBegin(count, t, threads); i < sliceBegin(count, t + 1, threads); i++) {
+                claim[i].store(0, memory_order_relaxed);
+            }
+            barrier.wait();
+
+            vector<size_t> offsets, nextOffsets;
+            for (int level = 0;; level++) {
+                const Frontier& frontier = frontiers[level & 1];
+                Frontier& next = frontiers[(level + 1) & 1];
+                computeOffsets(frontier, offsets);
+                size_t total = offsets.back();
+                if (total == 0 || cut != SIZE_MAX) {
+                    break;  // alle Threads sehen denselben Stand (nach der letzten Barriere)
+                }
+                size_t begin = sliceBegin(total, t, threads), end = sliceBegin(total, t + 1, threads);
+
+                // Phase 1: kleinsten Schluessel fuer jedes noch nicht erreichte Nachbarfeld sichern
+                forRange(frontier, offsets, begin, end, [&](size_t i, uint32_t node) {
+                    int x = map.indexToX(node), y = map.indexToY(node);
+                    for (unsigned freeMask = Neighbourhood::moves(map, x, y); freeMask != 0; freeMask &= freeMask - 1) {
+                        int d = countTrailingZeros(freeMask);
+                        size_t target = map.index(x + Neighbourhood::dx[d], y + Neighbourhood::dy[d]);
+                        if (distance.at(target) != -1) {
+                            continue;
+                        }
+                        uint32_t key = UINT32_MAX - static_cast<uint32_t>(i * Neighbourhood::count + d);
+                        uint32_t current = claim[target].load(memory_order_relaxed);
+                        while (key > current && !claim[target].compare_exchange_weak(current, key, memory_order_relaxed)) {
+                        }
+                    }
+                });
+                barrier.wait();
+
+                // Phase 2: gewonnene Felder in Queue-Reihenfolge sammeln (noch ohne Schreiben)
+                vector<uint32_t>& own = next[t];
+                own.clear();
+                goalPosition[t] = SIZE_MAX;
+                forRange(frontier, offsets, begin, end, [&](size_t i, uint32_t node) {
+                    int x = map.indexToX(node), y = map.indexToY(node);
+                    for (unsigned freeMask = Neighbourhood::moves(map, x, y); freeMask != 0; freeMask &= freeMask - 1) {
+                        int d = countTrailingZeros(freeMask);
+                        size_t target = map.index(x + Neighbourhood::dx[d], y + Neighbourhood::dy[d]);
+                        uint32_t key = UINT32_MAX - static_cast<uint32_t>(i * Neighbourhood::count + d);
+                        if (distance.at(target) == -1 && claim[target].load(memory_order_relaxed) == key) {
+                            if (target == goal && goalPosition[t] == SIZE_MAX) {
+                                goalPosition[t] = own.size();
+                            }
+                            own.push_back(static_cast<uint32_t>(target));
+                        }
+                    }
+                });
+                barrier.wait();
+
+                // Phase 3: Positionen und Abbruch (jeder Thread rechnet dasselbe), dann eintragen
+                computeOffsets(next, nextOffsets);
+                size_t levelCut = SIZE_MAX;
+                for (int k = 0; k < threads; k++) {
+                    if (goalPosition[k] != SIZE_MAX) {
+                        levelCut = nextOffsets[k] + goalPosition[k] + 1;  // serielle Suche endet nach dem Ziel
+                        break;
+                    }
+                }
+                size_t limit = levelCut == SIZE_MAX ? own.size()
+                    : (levelCut > nextOffsets[t] ? min(own.size(), levelCut - nextOffsets[t]) : 0);
+                for (size_t k = 0; k < limit; k++) {
+                    distance.at(own[k]) = level + 1;
+                    visited.at(own[k]) = level + 1;
+                }
+                if (t == 0) {
+                    cut = levelCut;
+                }
+                barrier.wait();
+            }
+        });
+
+        if (cut == SIZE_MAX) {
+            return { -1, {} };  // Ziel ist nicht erreichbar
+        }
+        // Rekonstruktion wie bei wavefront: zum ersten Nachbarn mit um 1 kleinerer Entfernung
+        vector<pair<int, int>> path;
+        int cx = goalX, cy = goalY;
+        while (!(cx == startX && cy == startY)) {
+            path.push_back({ cy, cx });
+            unsigned moves = Neighbourhood::moves(map, cx, cy);
+            for (int k = 0; k < Neighbourhood::count; k++) {
+                int px = cx + Neighbourhood::dx[k];
+                int py = cy + Neighbourhood::dy[k];
+                if ((moves & (1u << k)) && distance.at(px, py) == distance.at(cx, cy) - 1) {
+                    cx = px;
+                    cy = py;
+                    break;
+                }
+            }
+        }
+        path.push_back({ startY, startX });
+        reverse(path.begin(), path.end());
+        return { distance.at(goal), path };
+    }
+
+    pair<int, vector<pair<int, int>>> wavefrontParallel(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, int threads, int connectivity) {
+        threads = resolveThreadCount(threads);
+        if (connectivity == 8) {
+            return wavefrontParallelSearch<EightConnected>(map, startX, startY, goalX, goalY, visited, threads);
+        }
+        return wavefrontParallelSearch<FourConnected>(map, startX, startY, goalX, goalY, visited, threads);
+    }
+
+    template <typename Neighbourhood>
+    static void brushfireParallelSearch(const Map& map, Grid<int>& visited, int threads) {
+        const int width = map.getWidth(), height = map.getHeight();
+        const int words = map.getObstacleWordsPerRow();
+        const size_t count = map.size();
+        const size_t bitmapWords = (count + 63) / 64;
+
+        // Besucht-Bitmap ueber die linearen Indizes; gesetzt = Hindernis oder schon erreicht
+        unique_ptr<atomic<uint64_t>[]> reached(new atomic<uint64_t>[bitmapWords]);
+        Frontier frontiers[2] = { Frontier(threads), Frontier(threads) };
+        LevelBarrier barrier(threads);
+
+        runWorkers(threads, [&](int t) {
+            for (size_t i = sliceBegin(bitmapWords, t, threads); i < sliceBegin(bitmapWords, t + 1, threads); i++) {
+                reached[i].store(0, memory_order_relaxed);
+            }
+            for (size_t i = sliceBegin(count, t, threads); i < sliceBegin(count, t + 1, threads); i++) {
+                visited.at(i) = -1;
+            }
+            barrier.wait();
+
+            // Ebene 0: Hindernisse eines Zeilenbands aus der Hindernis-Bitmap
+            vector<uint32_t>& obstacles = frontiers[0][t];
+            obstacles.clear();
+            int rowBegin = static_cast<int>(sliceBegin(height, t, threads));
+            int rowEnd = static_cast<int>(sliceBegin(height, t + 1, threads));
+            for (int y = rowBegin; y < rowEnd; y++) {
+                const uint64_t* bits = map.obstacleRow(y);
+                for (int w = 0; w < words; w++) {
+                    uint64_t word = bits[w];
+                    while (word != 0) {
+                        int x = w * 64 + countTrailingZeros(word) - 1; // Bit x + 1 gehoert zu Spalte x
+                        word &= word - 1;
+                        if (x < 0 || x >= width) {
+                            continue; // Rand der Bitmap
+                        }
+                        size_t i = map.index(x, y);
+                        visited.at(i) = 0;
+                        reached[i >> 6].fetch_or(uint64_t(1) << (i & 63), memory_order_relaxed);
+                        obstacles.push_back(static_cast<uint32_t>(i));
+                    }
+                }
+            }
+            barrier.wait();
+
+            vector<size_t> offsets;
+            for (int level = 0;; level++) {
+                const Frontier& frontier = frontiers[level & 1];
+                computeOffsets(frontier, offsets);
+                size_t total = offsets.back();
+                if (total == 0) {
+                    break;
+                }
+                vector<uint32_t>& own = frontiers[(level + 1) & 1][t];
+                own.clear();
+                forRange(frontier, offsets, sliceBegin(total, t, threads), sliceBegin(total, t + 1, threads), [&](size_t, uint32_t node) {
+                    int x = map.indexToX(node), y = map.indexToY(node);
+                    for (unsigned freeMask = Neighbourhood::moves(map, x, y); freeMask != 0; freeMask &= freeMask - 1) {
+                        int d = countTrailingZeros(freeMask);
+                        size_t target = map.index(x + Neighbourhood::dx[d], y + Neighbourhood::dy[d]);
+                        uint64_t bit = uint64_t(1) << (target & 63);
+                        if ((reached[target >> 6].load(memory_order_relaxed) & bit) != 0
+                            || (reached[target >> 6].fetch_or(bit, memory_order_relaxed) & bit) != 0) {
+                            continue;  // schon erreicht (oder ein anderer Thread war schneller)
+                        }
+                        visited.at(target) = level + 1;
+                        own.push_back(static_cast<uint32_t>(target));
+                    }
+                });
+                barrier.wait();
+            }
+        });
+    }
+
+    void brushfireParallel(const Map& map, Grid<int>& visited, int threads, int connectivity) {
+        threads = resolveThreadCount(threads);
+        if (connectivity == 8) {
+            brushfireParallelSearch<EightConnected>(map, visited, threads);
+        }
+        else {
+            brushfireParallelSearch<FourConnected>(map, visited, threads);
+        }
+    }
+
+}
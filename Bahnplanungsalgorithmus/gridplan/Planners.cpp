@@ -0,0 +1,678 @@
+#include "Planners.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <memory>
+#include <queue>
+#include <tuple>
+#include "../BitOps.h"
+#include "MemoryProbe.h"
+#include "OpenList.h"
+#include "SearchPolicies.h"
+
+using namespace std;
+
+namespace gridplan {
+
+    // Wavefront-Algorithmus: Berechnet die minimalen Entfernungen vom Start (2) zum Ziel (3)
+    // in Schritten der Nachbarschaft (SearchPolicies.h). Der Pfad wird wie bisher als
+    // Liste von (Zeile, Spalte) zurueckgegeben.
+    template <typename Neighbourhood>
+    static pair<int, vector<pair<int, int>>> wavefrontSearch(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, SearchWorkspace& workspace) {
+        workspace.begin();
+
+        // Matrix fuer Entfernungen (-1 bedeutet "nicht erreichbar")
+        Grid<int>& distance = workspace.distance();
+
+        // BFS-Queue mit linearen Indizes; eingereihte Felder bleiben stehen und sind damit
+        // zugleich die beruehrten Felder fuer den naechsten SearchWorkspace::begin
+        vector<uint32_t>& q = workspace.touched;
+        size_t head = 0;
+
+        // Startpunkt setzen (Startpunkt hat Distanz 0)
+        size_t start = map.index(startX, startY);
+        distance.at(start) = 0;
+        visited.at(start) = 0;  // Start ist das erste abgelaufene Feld
+        q.push_back(static_cast<uint32_t>(start));
+
+        vector<pair<int, int>> path;  // Um den Pfad zu speichern
+
+        // Breitensuche durchfuehren
+        while (head < q.size()) {
+            size_t current = q[head++];  // Entfernen des Elements aus der Queue
+            int x = map.indexToX(current);
+            int y = map.indexToY(current);
+
+            // Freie Nachbarn ueber die Hindernis-Bitmap bestimmen (enthaelt bereits die Randpruefung)
+            unsigned freeMask = Neighbourhood::moves(map, x, y);
+
+            // Ueberpruefen der Nachbarn
+            for (int d = 0; d < Neighbourhood::count; d++) {
+                if (!(freeMask & (1u << d))) {
+                    continue;
+                }
+                int nx = x + Neighbourhood::dx[d];
+                int ny = y + Neighbourhood::dy[d];
+                size_t next = map.index(nx, ny);
+
+                // Ueberpruefen, ob der Nachbar noch nicht besucht wurde
+                if (distance.at(next) == -1) {
+                    distance.at(next) = distance.at(current) + 1;
+                    visited.at(next) = distance.at(next);  // Speichern der abgelaufenen Felder mit Entfernungen
+                    q.push_back(static_cast<uint32_t>(next));
+
+                    // Wenn das Ziel erreicht wurde, speichern wir den Pfad
+                    if (nx == goalX && ny == goalY) {
+                        // Rekonstruktion des Pfades
+                        int cx = nx, cy = ny;
+                        while (!(cx == startX && cy == startY)) {
+                            path.push_back({ cy, cx });
+                            unsigned moves = Neighbourhood::moves(map, cx, cy);
+                            for (int k = 0; k < Neighbourhood::count; k++) {
+                                int px = cx + Neighbourhood::dx[k];
+                                int py = cy + Neighbourhood::dy[k];
+                                if ((moves & (1u << k)) && distance.at(px, py) == distance.at(cx, cy) - 1) {
+                                    cx = px;
+                                    cy = py;
+                                    break;
+                                }
+                            }
+                        }
+                        path.push_back({ startY, startX });
+                        reverse(path.begin(), path.end());  // Pfad umkehren, da wir rueckwaerts rekonstruieren
+                        return { distance.at(next), path };
+                    }
+                }
+            }
+        }
+
+        return { -1, path };  // Ziel ist nicht erreichbar
+    }
+
+    pair<int, vector<pair<int, int>>> wavefront(const Map& map, int startX, int startY, int goalX, int goalY, Grid<int>& visited,
+        int connectivity, SearchWorkspace* workspace) {
+        if (workspace == nullptr) {
+            SearchWorkspace local(map);
+            return wavefront(map, startX, startY, goalX, goalY, visited, connectivity, &local);
+        }
+        if (connectivity == 8) {
+            return wavefrontSearch<EightConnected>(map, startX, startY, goalX, goalY, visited, *workspace);
+        }
+        return wavefrontSearch<FourConnected>(map, startX, startY, goalX, goalY, visited, *workspace);
+    }
+
+    // A*-Algorithmus, instanziiert fuer Heuristik, Nachbarschaft, Kostenmodell (SearchPolicies.h)
+    // und offene Liste (DaryHeap, BucketQueue oder RadixHeap). Die Heuristik ist bereits auf das
+    // Ziel eingestellt. Der Pfad wird als Liste von (Zeile, Spalte) zurueckgegeben, die Laenge in
+    // Kosteneinheiten der Nachbarschaft (mit Gelaendekosten multipliziert).
+    template <typename Heuristic, typename Neighbourhood, typename CostModel, typename OpenList>
+    static pair<int, vector<pair<int, int>>> aStarSearch(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, const Heuristic& calculateHeuristic, const CostModel& costModel, SearchStats& counters,
+        SearchWorkspace& workspace) {
+
+        // gScore und offene Liste aus dem Arbeitsspeicher; touched erhaelt jedes Feld beim
+        // ersten endlichen gScore
+        workspace.begin();
+        Grid<int>& gScore = workspace.gScore();
+        OpenList& openSet = workspace.openList<OpenList>();
+        vector<uint32_t>& touched = workspace.touched;
+        size_t start = map.index(startX, startY);
+        visited.at(start) = 0;
+
+        gScore.at(start) = 0;
+        touched.push_back(static_cast<uint32_t>(start));
+        int startH = costModel.scaleHeuristic(calculateHeuristic(startX, startY));
+        openSet.pushOrDecrease(static_cast<uint32_t>(start), startH, startH, counters);
+
+        vector<pair<int, int>> path;
+
+        while (!openSet.empty()) {
+            size_t current = openSet.popMin();
+            counters.expansions++;
+
+            int x = map.indexToX(current), y = map.indexToY(current);
+
+            if (x == goalX && y == goalY) {
+                // Rueckwaerts zu einem Vorgaenger, dessen g genau um die Zugkosten kleiner ist
+                while (!(x == startX && y == startY)) {
+                    path.push_back({ y, x });
+                    int g = gScore.at(x, y);
+                    size_t here = map.index(x, y);
+                    unsigned freeMask = Neighbourhood::moves(map, x, y);
+                    for (int d = 0; d < Neighbourhood::count; d++) {
+                        if (!(freeMask & (1u << Neighbourhood::reverse[d]))) {
+                            continue;
+                        }
+                        int px = x - Neighbourhood::dx[d], py = y - Neighbourhood::dy[d];
+                        if (gScore.at(px, py) == g - costModel.step(here, d)) {
+                            x = px;
+                            y = py;
+                            break;
+                        }
+                    }
+                }
+                path.push_back({ startY, startX });
+                reverse(path.begin(), path.end());
+                return { gScore.at(current), path };
+            }
+
+            // Freie Zuege als Bitmaske (inkl. Randpruefung), gesetzte Bits der Reihe nach
+            int g = gScore.at(current);
+            for (unsigned freeMask = Neighbourhood::moves(map, x, y); freeMask != 0; freeMask &= freeMask - 1) {
+                int d = countTrailingZeros(freeMask);
+                int nx = x + Neighbourhood::dx[d], ny = y + Neighbourhood::dy[d];
+                size_t next = map.index(nx, ny);
+                // Alle zulaessigen Heuristiken sind konsistent: geschlossene Knoten haben bereits ihr minimales g
+                if (openSet.isClosed(static_cast<uint32_t>(next))) {
+                    continue;
+                }
+                int tentative_gScore = g + costModel.step(next, d);
+
+                if (tentative_gScore < gScore.at(next)) {
+                    if (gScore.at(next) == INT_MAX) {
+                        touched.push_back(static_cast<uint32_t>(next));
+                    }
+                    gScore.at(next) = tentative_gScore;
+                    visited.at(next) = tentative_gScore;
+                    int h = costModel.scaleHeuristic(calculateHeuristic(nx, ny));
+                    openSet.pushOrDecrease(static_cast<uint32_t>(next), tentative_gScore + h, h, counters);
+                }
+            }
+        }
+
+        return { -1, path };
+    }
+
+    // Einmalige Auswahl der Instanz: Heuristik, dann Kostenmodell, Nachbarschaft und offene Liste
+    template <typename Neighbourhood, typename CostModel, typename OpenList>
+    static pair<int, vector<pair<int, int>>> aStarWithHeuristic(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, const Landmarks* landmarks, const CostModel& costModel,
+        SearchStats& counters, SearchWorkspace& workspace) {
+        if (heuristic == HeuristicKind::Landmarks && landmarks != nullptr) {
+            const LandmarkHeuristic<Neighbourhood> alt(map, *landmarks, goalX, goalY);
+            return aStarSearch<LandmarkHeuristic<Neighbourhood>, Neighbourhood, CostModel, OpenList>(map, startX, startY, goalX, goalY,
+                visited, alt, costModel, counters, workspace);
+        }
+        if (heuristic == HeuristicKind::Airplane) {
+            return aStarSearch<AirplaneHeuristic<Neighbourhood>, Neighbourhood, CostModel, OpenList>(map, startX, startY, goalX, goalY,
+                visited, AirplaneHeuristic<Neighbourhood>{ goalX, goalY }, costModel, counters, workspace);
+        }
+        if (heuristic == HeuristicKind::Octile || heuristic == HeuristicKind::Landmarks) {
+            return aStarSearch<OctileHeuristic<Neighbourhood>, Neighbourhood, CostModel, OpenList>(map, startX, startY, goalX, goalY,
+                visited, OctileHeuristic<Neighbourhood>{ goalX, goalY }, costModel, counters, workspace);
+        }
+        if (heuristic == HeuristicKind::Zero) {
+            return aStarSearch<ZeroHeuristic<Neighbourhood>, Neighbourhood, CostModel, OpenList>(map, startX, startY, goalX, goalY,
+                visited, ZeroHeuristic<Neighbourhood>{ goalX, goalY }, costModel, counters, workspace);
+        }
+        return aStarSearch<ManhattanHeuristic<Neighbourhood>, Neighbourhood, CostModel, OpenList>(map, startX, startY, goalX, goalY,
+            visited, ManhattanHeuristic<Neighbourhood>{ goalX, goalY }, costModel, counters, workspace);
+    }
+
+    template <typename Neighbourhood, typename OpenList>
+    static pair<int, vector<pair<int, int>>> aStarWithCosts(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, const Landmarks* landmarks, const CostMap* costs, SearchStats& counters,
+        SearchWorkspace& workspace) {
+        if (costs != nullptr) {
+            const TerrainCost<Neighbourhood> terrain{ costs->data(), costs->getMinCost() };
+            return aStarWithHeuristic<Neighbourhood, TerrainCost<Neighbourhood>, OpenList>(map, startX, startY, goalX, goalY,
+                visited, heuristic, landmarks, terrain, counters, workspace);
+        }
+        return aStarWithHeuristic<Neighbourhood, UniformCost<Neighbourhood>, OpenList>(map, startX, startY, goalX, goalY,
+            visited, heuristic, landmarks, UniformCost<Neighbourhood>(), counters, workspace);
+    }
+
+    template <typename OpenList>
+    static pair<int, vector<pair<int, int>>> aStarWithOpenList(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, const Landmarks* landmarks, int connectivity, const CostMap* costs,
+        SearchStats& counters, SearchWorkspace& workspace) {
+        if (connectivity == 8) {
+            return aStarWithCosts<EightConnected, OpenList>(map, startX, startY, goalX, goalY, visited, heuristic, landmarks, costs,
+                counters, workspace);
+        }
+        return aStarWithCosts<FourConnected, OpenList>(map, startX, startY, goalX, goalY, visited, heuristic, landmarks, costs,
+            counters, workspace);
+    }
+
+    pair<int, vector<pair<int, int>>> aStar(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats, OpenListKind openList, int connectivity,
+        const CostMap* costs, SearchWorkspace* workspace, const Landmarks* landmarks) {
+        if (workspace == nullptr) {
+            SearchWorkspace local(map);
+            return aStar(map, startX, startY, goalX, goalY, visited, heuristic, stats, openList, connectivity, costs, &local,
+                landmarks);
+        }
+        SearchStats localStats;
+        SearchStats& counters = stats != nullptr ? *stats : localStats;
+        // Tabellen einer anderen Karte oder Nachbarschaft waeren keine gueltige Schranke
+        if (landmarks != nullptr && !landmarks->matches(map, connectivity)) {
+            landmarks = nullptr;
+        }
+        if (openList == OpenListKind::Bucket) {
+            return aStarWithOpenList<BucketQueue>(map, startX, startY, goalX, goalY, visited, heuristic, landmarks, connectivity, costs,
+                counters, *workspace);
+        }
+        if (openList == OpenListKind::Radix) {
+            return aStarWithOpenList<RadixHeap>(map, startX, startY, goalX, goalY, visited, heuristic, landmarks, connectivity, costs,
+                counters, *workspace);
+        }
+        return aStarWithOpenList<DaryHeap<4>>(map, startX, startY, goalX, goalY, visited, heuristic, landmarks, connectivity, costs,
+            counters, *workspace);
+    }
+
+    // Brushfire in der Nachbarschaft Neighbourhood: Schritte zum naechsten Hindernis
+    // (4er: Manhattan-, 8er: Schachbrettabstand)
+    template <typename Neighbourhood>
+    static void brushfireSearch(const Map& map, Grid<int>& visited) {
+        int width = map.getWidth();
+        int height = map.getHeight();
+        int words = map.getObstacleWordsPerRow();
+        queue<size_t> q;
+
+        visited.fill(-1); // Nicht besuchte Felder setzen auf -1
+
+        // Alle Hindernisse als Startpunkte hinzufuegen. Die Bitmap wird wortweise
+        // gelesen, so dass 64 freie Kacheln mit einem Vergleich uebersprungen werden.
+        for (int y = 0; y < height; y++) {
+            const uint64_t* bits = map.obstacleRow(y);
+            for (int w = 0; w < words; w++) {
+                uint64_t word = bits[w];
+                while (word != 0) {
+                    int x = w * 64 + countTrailingZeros(word) - 1; // Bit x + 1 gehoert zu Spalte x
+                    word &= word - 1;
+                    if (x < 0 || x >= width) {
+                        continue; // Rand der Bitmap
+                    }
+                    size_t i = map.index(x, y);
+                    visited.at(i) = 0; // Hindernisse haben Distanz 0
+                    q.push(i);
+                }
+            }
+        }
+        while (!q.empty()) {
+            size_t current = q.front();
+            int x = map.indexToX(current);
+            int y = map.indexToY(current);
+            q.pop();
+
+            // Freie Nachbarn ueber die Hindernis-Bitmap (inkl. Randpruefung)
+            unsigned freeMask = Neighbourhood::moves(map, x, y);
+
+            for (int d = 0; d < Neighbourhood::count; d++) {
+                if (!(freeMask & (1u << d))) {
+                    continue;
+                }
+                size_t next = map.index(x + Neighbourhood::dx[d], y + Neighbourhood::dy[d]);
+
+                // Noch nicht besucht (visited == -1)?
+                if (visited.at(next) == -1) {
+                    visited.at(next) = visited.at(current) + 1; // Entfernungswert setzen
+                    q.push(next); // Nachbarn in die Queue einfuegen
+                }
+            }
+        }
+    }
+
+    void brushfire(const Map& map, Grid<int>& visited, int connectivity) {
+        if (connectivity == 8) {
+            brushfireSearch<EightConnected>(map, visited);
+        }
+        else {
+            brushfireSearch<FourConnected>(map, visited);
+        }
+    }
+
+    // Einfache, parallele oder bidirektionale Breitensuche
+    static pair<int, vector<pair<int, int>>> runWavefrontVariant(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, bool bidirectional, int connectivity, int threads) {
+        if (bidirectional) {
+            return wavefrontBidirectional(map, startX, startY, goalX, goalY, visited, connectivity);
+        }
+        if (threads > 1) {
+            return wavefrontParallel(map, startX, startY, goalX, goalY, visited, threads, connectivity);
+        }
+        return wavefront(map, startX, startY, goalX, goalY, visited, connectivity);
+    }
+
+    PlanResult runWavefront(const Map& map, const RepeatOptions& repeat, bool bidirectional, int connectivity, int threads) {
+        PlanResult result;
+        connectivity = normalizeConnectivity(connectivity);
+        threads = bidirectional ? 1 : resolveThreadCount(threads);
+        result.connectivity = connectivity;  // Breitensuche: Schritte, cost_scale bleibt 1
+        result.threads = threads;
+        MemoryProbe memoryProbe;
+        memoryProbe.start();
+
+        // Start- und Zielposition aus dem Index der Map (beim Laden miterfasst)
+        // Als einzelne Variablen, damit die Wiederholungsmessung sie im Lambda verwenden kann
+        int startX, startY, goalX, goalY;
+        tie(startX, startY) = map.getStart();
+        tie(goalX, goalY) = map.getGoal();
+        if (startX == -1) {
+            result.statusCode = 402;
+            return result;
+        }
+        if (goalX == -1) {
+            result.statusCode = 403;
+            return result;
+        }
+
+        auto startTime = chrono::high_resolution_clock::now();
+
+        // Matrix fuer besuchte Felder erstellen, -1 bedeutet "nicht besucht"
+        result.algorithmMap = Grid<int>(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        auto [distanceToGoal, path] = runWavefrontVariant(map, startX, startY, goalX, goalY, result.algorithmMap, bidirectional,
+            connectivity, threads);
+        result.bidirectional = bidirectional;
+
+        auto endTime = chrono::high_resolution_clock::now();
+        auto duration = chrono::duration_cast<chrono::nanoseconds>(endTime - startTime);
+
+        result.statusCode = (distanceToGoal != -1) ? 200 : 404;
+        result.pathLength = distanceToGoal;
+        result.path = move(path);
+        result.computingTime = duration.count() / 1000000.0;
+        result.memory = memoryProbe.stop();
+
+        if (repeat.enabled()) {
+            // Jeder Lauf mit frischer Besuchsmatrix, wie bei der Einzelmessung
+            result.timing = measureRepeated(repeat, [&]() {
+                Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+                runWavefrontVariant(map, startX, startY, goalX, goalY, visited, bidirectional, connectivity, threads);
+            });
+            result.computingTime = result.timing.median;
+        }
+        return result;
+    }
+
+    // A* oder Jump Point Search je nach Optionen
+    static pair<int, vector<pair<int, int>>> runAStarVariant(const Map& map, int startX, int startY, int goalX, int goalY,
+        Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats, const AStarOptions& options) {
+        if (options.bidirectional) {
+            return aStarBidirectional(map, startX, startY, goalX, goalY, visited, heuristic, stats, options.connectivity);
+        }
+        if (options.jumpPoints) {
+            return jumpPointSearch(map, startX, startY, goalX, goalY, visited, heuristic, stats, options.openList,
+                options.connectivity);
+        }
+        return aStar(map, startX, startY, goalX, goalY, visited, heuristic, stats, options.openList, options.connectivity,
+            options.costs, nullptr, options.landmarks);
+    }
+
+    PlanResult runAStar(const Map& map, const string& heuristic, const RepeatOptions& repeat, const AStarOptions& options) {
+        PlanResult result;
+        AStarOptions aStarOptions = options;
+        aStarOptions.connectivity = normalizeConnectivity(aStarOptions.connectivity);
+        // Name der Heuristik einmal aufloesen; Manhattan ueberschaetzt bei 8er-Nachbarschaft
+        HeuristicKind heuristicKind;
+        if (!parseHeuristic(heuristic, heuristicKind)
+            || (aStarOptions.connectivity == 8 && heuristicKind == HeuristicKind::Manhattan)) {
+            result.statusCode = 401;
+            return result;
+        }
+        // Die bidirektionale Suche verwendet immer ihren eigenen Heap und kein JPS; andere Varianten
+        // wuerden stillschweigend ignoriert und in der JSON falsch ausgewiesen
+        if (aStarOptions.bidirectional && (aStarOptions.openList != OpenListKind::Heap || aStarOptions.jumpPoints)) {
+            result.statusCode = 401;
+            return result;
+        }
+        // Gelaendekosten nur mit dem A*-Kern; JPS und die bidirektionale Suche setzen einheitliche Kosten voraus.
+        // Die Eimerliste nach Dial legt einen Eimer je f-Wert an, mit Kosten bis 255 je Schritt sind das zu viele.
+        if (aStarOptions.costs != nullptr) {
+            if (aStarOptions.jumpPoints || aStarOptions.bidirectional || aStarOptions.openList == OpenListKind::Bucket) {
+                result.statusCode = 401;
+                return result;
+            }
+            if (!aStarOptions.costs->matches(map)) {
+                result.statusCode = 500;
+                return result;
+            }
+            result.terrainCosts = true;
+        }
+        // Landmarken ebenfalls nur mit dem A*-Kern; ohne uebergebene Tabellen werden sie hier aufgebaut
+        unique_ptr<Landmarks> ownLandmarks;
+        if (heuristicKind == HeuristicKind::Landmarks) {
+            if (aStarOptions.jumpPoints || aStarOptions.bidirectional) {
+                result.statusCode = 401;
+                return result;
+            }
+            if (aStarOptions.landmarks == nullptr) {
+                auto preprocessingStart = chrono::high_resolution_clock::now();
+                ownLandmarks = make_unique<Landmarks>(map, aStarOptions.landmarkCount, aStarOptions.landmarkSelection,
+                    aStarOptions.connectivity);
+                auto preprocessingEnd = chrono::high_resolution_clock::now();
+                result.preprocessingTime =
+                    chrono::duration_cast<chrono::nanoseconds>(preprocessingEnd - preprocessingStart).count() / 1000000.0;
+                aStarOptions.landmarks = ownLandmarks.get();
+            }
+            else if (!aStarOptions.landmarks->matches(map, aStarOptions.connectivity)) {
+                result.statusCode = 500;
+                return result;
+            }
+            result.landmarkCount = aStarOptions.landmarks->getCount();
+            result.landmarkSelection = aStarOptions.landmarks->getSelection();
+        }
+        result.connectivity = aStarOptions.connectivity;
+        result.costScale = costScale(aStarOptions.connectivity);
+        MemoryProbe memoryProbe;
+        memoryProbe.start();
+
+        // Start und Ziel stehen im Index der Map (beim Laden miterfasst)
+        // Als einzelne Variablen, damit die Wiederholungsmessung sie im Lambda verwenden kann
+        int startX, startY, goalX, goalY;
+        tie(startX, startY) = map.getStart();
+        tie(goalX, goalY) = map.getGoal();
+        if (startX == -1) {
+            result.statusCode = 402;
+            return result;
+        }
+        if (goalX == -1) {
+            result.statusCode = 403;
+            return result;
+        }
+
+        auto startTime = chrono::high_resolution_clock::now();
+
+        result.algorithmMap = Grid<int>(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        auto [distanceToGoal, path] = runAStarVariant(map, startX, startY, goalX, goalY, result.algorithmMap, heuristicKind,
+            &result.search, aStarOptions);
+        result.hasSearchStats = true;
+        result.aStarOptions = aStarOptions;
+        result.searchName = aStarOptions.jumpPoints ? "jps" : "astar";
+        result.bidirectional = aStarOptions.bidirectional;
+
+        auto endTime = chrono::high_resolution_clock::now();
+        auto duration = chrono::duration_cast<chrono::nanoseconds>(endTime - startTime);
+
+        result.statusCode = (distanceToGoal != -1) ? 200 : 404;
+        result.pathLength = distanceToGoal;
+        result.path = move(path);
+        result.computingTime = duration.count() / 1000000.0;
+        result.memory = memoryProbe.stop();
+
+        if (repeat.enabled()) {
+            result.timing = measureRepeated(repeat, [&]() {
+                Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+                runAStarVariant(map, startX, startY, goalX, goalY, visited, heuristicKind, nullptr, aStarOptions);
+            });
+            result.computingTime = result.timing.median;
+        }
+        result.aStarOptions.landmarks = nullptr;  // eigene Tabellen leben nur in diesem Aufruf
+        return result;
+    }
+
+    PlanResult runDijkstra(const Map& map, const CostMap& costs, const RepeatOptions& repeat, int connectivity,
+        OpenListKind openList) {
+        PlanResult result;
+        connectivity = normalizeConnectivity(connectivity);
+        if (openList == OpenListKind::Bucket) {
+            result.statusCode = 401;  // wie runAStar: keine Eimerliste mit Gelaendekosten
+            return result;
+        }
+        if (!costs.matches(map)) {
+            result.statusCode = 500;
+            return result;
+        }
+        result.connectivity = connectivity;
+        result.costScale = costScale(connectivity);
+        result.terrainCosts = true;
+        MemoryProbe memoryProbe;
+        memoryProbe.start();
+
+        int startX, startY, goalX, goalY;
+        tie(startX, startY) = map.getStart();
+        tie(goalX, goalY) = map.getGoal();
+        if (startX == -1) {
+            result.statusCode = 402;
+            return result;
+        }
+        if (goalX == -1) {
+            result.statusCode = 403;
+            return result;
+        }
+
+        auto startTime = chrono::high_resolution_clock::now();
+
+        result.algorithmMap = Grid<int>(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        auto [distanceToGoal, path] = aStar(map, startX, startY, goalX, goalY, result.algorithmMap, HeuristicKind::Zero,
+            &result.search, openList, connectivity, &costs);
+        result.hasSearchStats = true;
+        result.aStarOptions.openList = openList;
+        result.aStarOptions.connectivity = connectivity;
+        result.searchName = "dijkstra";
+
+        auto endTime = chrono::high_resolution_clock::now();
+        auto duration = chrono::duration_cast<chrono::nanoseconds>(endTime - startTime);
+
+        result.statusCode = (distanceToGoal != -1) ? 200 : 404;
+        result.pathLength = distanceToGoal;
+        result.path = move(path);
+        result.computingTime = duration.count() / 1000000.0;
+        result.memory = memoryProbe.stop();
+
+        if (repeat.enabled()) {
+            result.timing = measureRepeated(repeat, [&]() {
+                Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+                aStar(map, startX, startY, goalX, goalY, visited, HeuristicKind::Zero, nullptr, openList, connectivity, &costs);
+            });
+            result.computingTime = result.timing.median;
+        }
+        return result;
+    }
+
+    PlanResult runHpaStar(const Map& map, const RepeatOptions& repeat, int connectivity, int clusterSize) {
+        auto startTime = chrono::high_resolution_clock::now();
+        HpaStar hierarchy(map, clusterSize, connectivity);
+        auto endTime = chrono::high_resolution_clock::now();
+
+        PlanResult result = runHpaStar(hierarchy, map, repeat);
+        result.preprocessingTime = chrono::duration_cast<chrono::nanoseconds>(endTime - startTime).count() / 1000000.0;
+        return result;
+    }
+
+    PlanResult runHpaStar(const HpaStar& hierarchy, const Map& map, const RepeatOptions& repeat) {
+        PlanResult result;
+        result.connectivity = hierarchy.getConnectivity();
+        result.costScale = costScale(result.connectivity);
+        result.clusterSize = hierarchy.getClusterSize();
+        result.abstractNodes = hierarchy.getNodeCount();
+        MemoryProbe memoryProbe;
+        memoryProbe.start();
+
+        int startX, startY, goalX, goalY;
+        tie(startX, startY) = map.getStart();
+        tie(goalX, goalY) = map.getGoal();
+        if (startX == -1) {
+            result.statusCode = 402;
+            return result;
+        }
+        if (goalX == -1) {
+            result.statusCode = 403;
+            return result;
+        }
+
+        auto startTime = chrono::high_resolution_clock::now();
+
+        result.algorithmMap = Grid<int>(map.getWidth(), map.getHeight(), -1, map.getLayout());
+        auto [distanceToGoal, path] = hierarchy.findPath(startX, startY, goalX, goalY, result.algorithmMap, &result.search);
+        result.hasSearchStats = true;
+        result.aStarOptions.connectivity = result.connectivity;
+        result.searchName = "hpa";
+
+        auto endTime = chrono::high_resolution_clock::now();
+        auto duration = chrono::duration_cast<chrono::nanoseconds>(endTime - startTime);
+
+        result.statusCode = (distanceToGoal != -1) ? 200 : 404;
+        result.pathLength = distanceToGoal;
+        result.path = move(path);
+        result.computingTime = duration.count() / 1000000.0;
+        result.memory = memoryProbe.stop();
+
+        if (repeat.enabled()) {
+            result.timing = measureRepeated(repeat, [&]() {
+                Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+                hierarchy.findPath(startX, startY, goalX, goalY, visited);
+            });
+            result.computingTime = result.timing.median;
+        }
+        return result;
+    }
+
+    // Serielle oder parallele Brushfire-Flutung bzw. Distanztransformation
+    static void runBrushfireVariant(const Map& map, Grid<int>& visited, int connectivity, int threads, BrushfireKernel kernel,
+        DistanceEncoding encoding) {
+        if (kernel == BrushfireKernel::Euclidean) {
+            brushfireEuclidean(map, visited, threads, encoding);
+        }
+        else if (kernel == BrushfireKernel::Chamfer) {
+            brushfireChamfer(map, visited, threads, connectivity);
+        }
+        else if (threads > 1) {
+            brushfireParallel(map, visited, threads, connectivity);
+        }
+        else {
+            brushfire(map, visited, connectivity);
+        }
+    }
+
+    PlanResult runBrushfire(const Map& map, const RepeatOptions& repeat, int connectivity, int threads, BrushfireKernel kernel,
+        DistanceEncoding encoding) {
+        PlanResult result;
+        result.hasPath = false;
+        connectivity = normalizeConnectivity(connectivity);
+        threads = resolveThreadCount(threads);
+        result.connectivity = connectivity;
+        result.threads = threads;
+        result.brushfireKernel = kernel;
+        if (kernel == BrushfireKernel::Euclidean) {
+            result.distanceEncoding = encoding;
+            result.costScale = encoding == DistanceEncoding::Fixed ? EUCLIDEAN_FIXED_SCALE : 1;
+        }
+        MemoryProbe memoryProbe;
+        memoryProbe.start();
+
+        auto startTime = chrono::high_resolution_clock::now();
+
+        result.algorithmMap = Grid<int>(map.getWidth(), map.getHeight(), -1, map.getLayout());  // -1 bedeutet "nicht besucht"
+        runBrushfireVariant(map, result.algorithmMap, connectivity, threads, kernel, encoding);
+
+        auto endTime = chrono::high_resolution_clock::now();
+        auto duration = chrono::duration_cast<chrono::nanoseconds>(endTime - startTime);
+
+        result.statusCode = 0;
+        result.computingTime = duration.count() / 1000000.0;
+        result.memory = memoryProbe.stop();
+
+        if (repeat.enabled()) {
+            result.timing = measureRepeated(repeat, [&]() {
+                Grid<int> visited(map.getWidth(), map.getHeight(), -1, map.getLayout());
+                runBrushfireVariant(map, visited, connectivity, threads, kernel, encoding);
+            });
+            result.computingTime = result.timing.median;
+        }
+        return result;
+    }
+
+}
@@ -0,0 +1,210 @@
+#ifndef GRIDPLAN_PLANNERS_H
+#define GRIDPLAN_PLANNERS_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "../CostMap.h"
+#include "../Map.h"
+#include "HpaStar.h"
+#include "Landmarks.h"
+#include "MemoryProbe.h"
+#include "OpenList.h"
+#include "SearchPolicies.h"
+#include "SearchWorkspace.h"
+#include "Timing.h"
+
+// Gemeinsamer Kern der C++-Planer: Wavefront, A* und Brushfire arbeiten direkt auf
+// Map. Die Programme in Cpp_Algorithms sind nur noch duenne Huellen um diese
+// Funktionen; MapWindow ruft sie ohne Umweg ueber run_algorithms.py auf.
+namespace gridplan {
+
+    // Varianten der A*-Suche (Programm A_Star: Argumente nach der Heuristik)
+    struct AStarOptions {
+        OpenListKind openList = OpenListKind::Heap;     // heap | bucket | radix
+        bool jumpPoints = false;                        // jps: Jump Point Search
+        bool bidirectional = false;                     // --bidirectional: zwei Threads, nur mit Heap ohne jps (sonst 401)
+        int connectivity = 4;                           // --connectivity 4|8 (8 ohne Eckenschneiden)
+        const CostMap* costs = nullptr;                 // --costs: Gelaendekosten (nicht mit jps/bidirektional)
+        int landmarkCount = 8;                          // --landmarks K (Heuristik landmarks)
+        LandmarkSelection landmarkSelection = LandmarkSelection::Farthest;  // --landmark-selection
+        const Landmarks* landmarks = nullptr;           // fertige Tabellen, sonst baut runAStar sie auf
+    };
+
+    // Verfahren fuer Brushfire (Kommandozeile --kernel): Flutung per Breitensuche,
+    // Distanztransformation in Rasterdurchlaeufen (gleiche algorithm_map) oder exakter
+    // euklidischer Abstand (algorithm_map in der Kodierung aus DistanceEncoding)
+    enum class BrushfireKernel { Bfs, Chamfer, Euclidean };
+
+    // "bfs", "chamfer" bzw. "euclidean"; false bei unbekanntem Namen
+    inline bool parseBrushfireKernel(const std::string& name, BrushfireKernel& kernel) {
+        if (name == "bfs") {
+            kernel = BrushfireKernel::Bfs;
+            return true;
+        }
+        if (name == "chamfer") {
+            kernel = BrushfireKernel::Chamfer;
+            return true;
+        }
+        if (name == "euclidean") {
+            kernel = BrushfireKernel::Euclidean;
+            return true;
+        }
+        return false;
+    }
+
+    inline const char* brushfireKernelName(BrushfireKernel kernel) {
+        switch (kernel) {
+        case BrushfireKernel::Chamfer: return "chamfer";
+        case BrushfireKernel::Euclidean: return "euclidean";
+        default: return "bfs";
+        }
+    }
+
+    // Kodierung des euklidischen Abstands in algorithm_map (Kommandozeile --encoding):
+    // squared = exaktes Abstandsquadrat in Kacheln^2, fixed = Abstand als Festkommazahl
+    // (gerundet, EUCLIDEAN_FIXED_SCALE Einheiten je Kachel, als cost_scale in der JSON)
+    enum class DistanceEncoding { Squared, Fixed };
+    const int EUCLIDEAN_FIXED_SCALE = 100;
+
+    // "squared" bzw. "fixed"; false bei unbekanntem Namen
+    inline bool parseDistanceEncoding(const std::string& name, DistanceEncoding& encoding) {
+        if (name == "squared") {
+            encoding = DistanceEncoding::Squared;
+            return true;
+        }
+        if (name == "fixed") {
+            encoding = DistanceEncoding::Fixed;
+            return true;
+        }
+        return false;
+    }
+
+    inline const char* distanceEncodingName(DistanceEncoding encoding) {
+        return encoding == DistanceEncoding::Fixed ? "fixed" : "squared";
+    }
+
+    // Ergebnis eines Planungslaufs, Felder wie in json_structure.txt
+    struct PlanResult {
+        Grid<int> algorithmMap;             // besuchte Felder mit Entfernung, -1 = nicht besucht
+        int statusCode = 0;                 // siehe status_codes.txt
+        int pathLength = -1;                // in Kosteneinheiten, siehe costScale
+        std::vector<std::pair<int, int>> path;  // (Zeile, Spalte) vom Start zum Ziel
+        double computingTime = 0;           // Millisekunden (Median bei Wiederholungsmessung)
+        TimingStats timing;                 // Verteilung bei --repeat/--warmup, sonst runs = 0
+        SearchStats search;                 // Zaehler der offenen Liste (nur A*)
+        bool hasSearchStats = false;        // true: expansions usw. in die JSON schreiben
+        AStarOptions aStarOptions;          // nur A*/Dijkstra
+        const char* searchName = "astar";   // "astar", "jps", "dijkstra" oder "hpa" (JSON: search)
+        bool terrainCosts = false;          // mit Gelaendekosten geplant (JSON: terrain_costs)
+        bool bidirectional = false;         // Wavefront/A* bidirektional (algorithm_map siehe unten)
+        int connectivity = 4;               // 4 oder 8 Nachbarn
+        int costScale = 1;                  // Kosten eines geraden Schritts (A* 8er: 70, sonst 1)
+        int threads = 1;                    // Threads der ebenensynchronen Breitensuche (Wavefront, Brushfire)
+        BrushfireKernel brushfireKernel = BrushfireKernel::Bfs;  // nur Brushfire
+        DistanceEncoding distanceEncoding = DistanceEncoding::Squared;  // nur Brushfire euclidean
+        int clusterSize = 0;                // nur HPA*: Kantenlaenge der Cluster (0 = kein HPA*)
+        int abstractNodes = 0;              // nur HPA*: Knoten des abstrakten Graphen
+        int landmarkCount = 0;              // nur A* landmarks: Anzahl der Landmarken (0 = andere Heuristik)
+        LandmarkSelection landmarkSelection = LandmarkSelection::Farthest;  // nur A* landmarks
+        double preprocessingTime = 0;       // HPA*/landmarks: Aufbau der Abstraktion bzw. Tabellen in Millisekunden
+        MemoryStats memory;                 // Speicherkennzahlen der Suche (memory_*)
+        bool hasPath = true;                // false bei Brushfire (kein Pfad in der JSON)
+    };
+
+    // Wavefront: Breitensuche vom Start zum Ziel in 4er- oder 8er-Nachbarschaft. visited
+    // erhaelt die Entfernungen (Schritte) aller besuchten Felder. Rueckgabe: Pfadlaenge
+    // (-1 = nicht erreichbar) und Pfad. Ohne workspace wird der Arbeitsspeicher fuer diesen
+    // Aufruf angelegt.
+    std::pair<int, std::vector<std::pair<int, int>>> wavefront(const Map& map, int startX, int startY,
+        int goalX, int goalY, Grid<int>& visited, int connectivity = 4, SearchWorkspace* workspace = nullptr);
+
+    // A* mit Heuristik Manhattan, Airplane (euklidisch, abgerundet) oder Octile in 4er- oder
+    // 8er-Nachbarschaft (connectivity, Kosten siehe SearchPolicies.h). Die offene Liste ist
+    // ein indizierter 4-aerer Heap, eine Bucket-Queue oder ein Radix-Heap (OpenList.h); stats
+    // erhaelt die Zaehler. Mit costs (gleiche Groesse und Anordnung wie map) kostet jeder Zug
+    // zusaetzlich die Gelaendekosten des betretenen Feldes; HeuristicKind::Zero ergibt Dijkstra.
+    // HeuristicKind::Landmarks verwendet die Tabellen landmarks; ohne passende Tabellen (Karte,
+    // Nachbarschaft) wird wie mit Octile gesucht. Jede Kombination ist eine eigene
+    // Template-Instanz. workspace wie bei wavefront.
+    std::pair<int, std::vector<std::pair<int, int>>> aStar(const Map& map, int startX, int startY,
+        int goalX, int goalY, Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats = nullptr,
+        OpenListKind openList = OpenListKind::Heap, int connectivity = 4, const CostMap* costs = nullptr,
+        SearchWorkspace* workspace = nullptr, const Landmarks* landmarks = nullptr);
+
+    // Jump Point Search (4er- oder 8er-Nachbarschaft), siehe JumpPointSearch.cpp. Liefert
+    // dieselbe optimale Pfadlaenge wie aStar; visited markiert alle beim Springen
+    // geprueften Felder mit ihrer Entfernung entlang des Sprungs.
+    std::pair<int, std::vector<std::pair<int, int>>> jumpPointSearch(const Map& map, int startX, int startY,
+        int goalX, int goalY, Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats = nullptr,
+        OpenListKind openList = OpenListKind::Heap, int connectivity = 4);
+
+    // Bidirektionale Varianten mit zwei Threads (Vorwaerts- und Rueckwaertssuche), siehe
+    // Bidirectional.cpp. Gleiche Pfadlaenge wie wavefront/aStar; visited enthaelt fuer die
+    // von der Vorwaertssuche erreichten Felder die Entfernung zum Start, fuer nur von der
+    // Rueckwaertssuche erreichte Felder die Entfernung zum Ziel.
+    std::pair<int, std::vector<std::pair<int, int>>> wavefrontBidirectional(const Map& map, int startX, int startY,
+        int goalX, int goalY, Grid<int>& visited, int connectivity = 4);
+    std::pair<int, std::vector<std::pair<int, int>>> aStarBidirectional(const Map& map, int startX, int startY,
+        int goalX, int goalY, Grid<int>& visited, HeuristicKind heuristic, SearchStats* stats = nullptr,
+        int connectivity = 4);
+
+    // Brushfire: Entfernung jedes freien Feldes zum naechsten Hindernis (Hindernisse = 0),
+    // in Schritten der 4er- oder 8er-Nachbarschaft
+    void brushfire(const Map& map, Grid<int>& visited, int connectivity = 4);
+
+    // Ebenensynchrone Breitensuche mit threads Threads (0 = alle Kerne), siehe ParallelBfs.cpp.
+    // visited, Pfadlaenge und Pfad sind Feld fuer Feld gleich wie bei wavefront bzw. brushfire.
+    std::pair<int, std::vector<std::pair<int, int>>> wavefrontParallel(const Map& map, int startX, int startY,
+        int goalX, int goalY, Grid<int>& visited, int threads, int connectivity = 4);
+    void brushfireParallel(const Map& map, Grid<int>& visited, int threads, int connectivity = 4);
+
+    // Brushfire als Distanztransformation (Manhattan bzw. Schachbrett) in zwei Rasterdurchlaeufen,
+    // SSE2 entlang der Zeilen; bei 4er-Nachbarschaft mit threads Threads ueber Zeilenbloecke und
+    // Spaltenstreifen, siehe DistanceTransform.cpp. visited ist Feld fuer Feld gleich wie bei brushfire.
+    void brushfireChamfer(const Map& map, Grid<int>& visited, int threads = 1, int connectivity = 4);
+
+    // Exakter euklidischer Abstand zum naechsten Hindernis (Mittelpunkt zu Mittelpunkt, ohne
+    // Nachbarschaft), separabel in linearer Zeit: Spalten parallel, dann Zeilen parallel,
+    // siehe DistanceTransform.cpp. Hindernisse = 0; ohne Hindernis bleibt visited -1.
+    void brushfireEuclidean(const Map& map, Grid<int>& visited, int threads = 1,
+        DistanceEncoding encoding = DistanceEncoding::Squared);
+
+    // Anzahl der Threads: threads > 0 unveraendert, sonst std::thread::hardware_concurrency()
+    int resolveThreadCount(int threads);
+
+    // Vollstaendige Laeufe wie in den Programmen: Start/Ziel aus dem Index der Map
+    // (Status 402/403), Heuristik pruefen (401), Zeit- und Speichermessung.
+    // Mit repeat.enabled() wird die Suche anschliessend wiederholt gemessen (timing).
+    // Bei 8er-Nachbarschaft ist manhattan nicht zulaessig (401), ebenso Gelaendekosten und
+    // landmarks mit jps oder --bidirectional; eine Kostenkarte anderer Groesse ergibt 500.
+    // Bei landmarks ohne aStarOptions.landmarks werden die Tabellen vor der Suche aufgebaut
+    // (preprocessingTime, nicht in computingTime enthalten); fremde Tabellen ergeben 500.
+    // threads > 1 (oder 0 = alle Kerne) waehlt bei Wavefront und Brushfire die parallele
+    // Breitensuche; mit bidirectional wird threads ignoriert. Brushfire mit kernel euclidean
+    // ignoriert connectivity und schreibt algorithm_map in der Kodierung encoding.
+    PlanResult runWavefront(const Map& map, const RepeatOptions& repeat = RepeatOptions(), bool bidirectional = false,
+        int connectivity = 4, int threads = 1);
+    PlanResult runAStar(const Map& map, const std::string& heuristic, const RepeatOptions& repeat = RepeatOptions(),
+        const AStarOptions& aStarOptions = AStarOptions());
+    PlanResult runBrushfire(const Map& map, const RepeatOptions& repeat = RepeatOptions(), int connectivity = 4,
+        int threads = 1, BrushfireKernel kernel = BrushfireKernel::Bfs,
+        DistanceEncoding encoding = DistanceEncoding::Squared);
+
+    // Dijkstra ueber Gelaendekosten (ersetzt die Breitensuche von Wavefront, wenn eine
+    // Kostenkarte angegeben ist). Standardmaessig mit Radix-Heap, da die Schluessel monoton
+    // steigen, aber nicht dicht liegen; OpenListKind::Bucket liefert Status 401.
+    PlanResult runDijkstra(const Map& map, const CostMap& costs, const RepeatOptions& repeat = RepeatOptions(),
+        int connectivity = 4, OpenListKind openList = OpenListKind::Radix);
+
+    // HPA* (HpaStar.h): baut die Abstraktion mit Clustern der Kantenlaenge clusterSize auf
+    // (preprocessingTime, nicht in computingTime enthalten) und plant darauf. Die zweite
+    // Fassung plant auf einer bestehenden Abstraktion derselben Karte, z. B. nach
+    // HpaStar::updateTile im Editor. Der Pfad ist gueltig, aber nicht immer optimal.
+    PlanResult runHpaStar(const Map& map, const RepeatOptions& repeat = RepeatOptions(), int connectivity = 4,
+        int clusterSize = 16);
+    PlanResult runHpaStar(const HpaStar& hierarchy, const Map& map, const RepeatOptions& repeat = RepeatOptions());
+
+}
+
+#endif
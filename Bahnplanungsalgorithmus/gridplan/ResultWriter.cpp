@@ -0,0 +1,100 @@
+#include "ResultWriter.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace gridplan {
+
+    bool saveResultsToJson(const PlanResult& result, const std::string& resultName) {
+        json result_json;
+
+        // Algorithmus Map (zeilenweise)
+        const Grid<int>& algorithmMap = result.algorithmMap;
+        json map_json = json::array();
+        std::vector<int> row(algorithmMap.getWidth());
+        for (int y = 0; y < algorithmMap.getHeight(); ++y) {
+            algorithmMap.copyRow(y, row.data());
+            map_json.push_back(row);
+        }
+        result_json["algorithm_map"] = map_json;
+        result_json["status_code"] = result.statusCode;
+
+        if (result.hasPath) {
+            // Pfadlaenge (in Kosteneinheiten, siehe cost_scale) und Pfad als (Zeile, Spalte)
+            result_json["path_length"] = result.pathLength;
+            json path_json = json::array();
+            for (const auto& p : result.path) {
+                path_json.push_back({ p.first, p.second });
+            }
+            result_json["path"] = path_json;
+        }
+
+        if (result.hasSearchStats) {
+            // Offene Liste und ihre Zaehler (A*, JPS, Dijkstra, HPA*)
+            result_json["search"] = result.searchName;
+            result_json["open_list"] = openListName(result.aStarOptions.openList);
+            result_json["expansions"] = result.search.expansions;
+            result_json["open_list_pushes"] = result.search.pushes;
+            result_json["open_list_decrease_keys"] = result.search.decreaseKeys;
+        }
+
+        if (result.bidirectional) {
+            result_json["bidirectional"] = true;
+        }
+        if (result.brushfireKernel != BrushfireKernel::Bfs) {
+            result_json["brushfire_kernel"] = brushfireKernelName(result.brushfireKernel);
+        }
+        if (result.brushfireKernel == BrushfireKernel::Euclidean) {
+            result_json["distance_encoding"] = distanceEncodingName(result.distanceEncoding);
+        }
+        if (result.clusterSize > 0) {
+            result_json["cluster_size"] = result.clusterSize;
+            result_json["abstract_nodes"] = result.abstractNodes;
+            result_json["preprocessing_time"] = result.preprocessingTime;
+        }
+        if (result.landmarkCount > 0) {
+            result_json["landmarks"] = result.landmarkCount;
+            result_json["landmark_selection"] = landmarkSelectionName(result.landmarkSelection);
+            result_json["preprocessing_time"] = result.preprocessingTime;
+        }
+        if (result.threads > 1) {
+            result_json["threads"] = result.threads;
+        }
+        if (result.terrainCosts) {
+            result_json["terrain_costs"] = true;
+        }
+
+        // Nachbarschaft und Kosteneinheit: path_length / cost_scale = Laenge in Kacheln
+        result_json["connectivity"] = result.connectivity;
+        result_json["cost_scale"] = result.costScale;
+
+        result_json["computing_time"] = result.computingTime;
+        if (result.timing.runs > 0) {
+            // Verteilung der Wiederholungsmessung (Millisekunden)
+            const TimingStats& t = result.timing;
+            result_json["computing_time_stats"] = {
+                {"runs", t.runs}, {"warmup", t.warmup}, {"min", t.min}, {"median", t.median},
+                {"mean", t.mean}, {"p95", t.p95}, {"stddev", t.stddev}, {"ci95", t.ci95},
+                {"converged", t.converged}
+            };
+        }
+        result_json["memory_usage"] = result.memory.usageDelta;
+        // Speicherkennzahlen der Suche: RSS und Spitzen-RSS in MB, angeforderte Bytes
+        result_json["memory_rss"] = result.memory.rss / (1024.0 * 1024.0);
+        result_json["memory_peak_rss"] = result.memory.peakRss / (1024.0 * 1024.0);
+        result_json["memory_allocated"] = result.memory.allocated;
+
+        std::ofstream output_file(resultName);
+        if (!output_file.is_open()) {
+            std::cerr << "Fehler beim Oeffnen der Datei zum Schreiben!" << std::endl;
+            return false;
+        }
+        output_file << std::setw(4) << result_json << std::endl;
+        std::cout << "Ergebnisse wurden in " << resultName << " gespeichert." << std::endl;
+        return true;
+    }
+
+}
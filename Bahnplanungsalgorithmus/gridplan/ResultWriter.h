@@ -0,0 +1,16 @@
+#ifndef GRIDPLAN_RESULTWRITER_H
+#define GRIDPLAN_RESULTWRITER_H
+
+#include <string>
+#include "Planners.h"
+
+namespace gridplan {
+
+    // Schreibt das Ergebnis als JSON (siehe json_structure.txt). Ohne Pfad
+    // (Brushfire) entfallen path_length und path. Gibt false zurueck, wenn die
+    // Datei nicht geschrieben werden konnte.
+    bool saveResultsToJson(const PlanResult& result, const std::string& resultName);
+
+}
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef GRIDPLAN_SEARCHPOLICIES_H
+#define GRIDPLAN_SEARCHPOLICIES_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include "../Map.h"
+
+// Heuristik und Nachbarschaft als Template-Parameter der Suchkerne (A*, JPS,
+// bidirektionaler A*). Der Name der Heuristik wird einmal beim Aufruf aufgeloest
+// (parseHeuristic), jede Instanz des Kerns enthaelt danach nur noch die eine
+// Formel ohne Zeichenkettenvergleich pro Nachbar.
+namespace gridplan {
+
+    // Heuristiken der A*-Suche (Kommandozeile: manhattan, airplane, octile oder landmarks).
+    // Zero (h = 0, also Dijkstra) wird nur intern von runDijkstra verwendet. Landmarks
+    // braucht vorberechnete Tabellen (Landmarks.h) und gibt es nur im einfachen A*-Kern.
+    enum class HeuristicKind { Manhattan, Airplane, Octile, Zero, Landmarks };
+
+    // "manhattan", "airplane", "octile" bzw. "landmarks"; false bei unbekanntem Namen
+    inline bool parseHeuristic(const std::string& name, HeuristicKind& kind) {
+        if (name == "manhattan") {
+            kind = HeuristicKind::Manhattan;
+            return true;
+        }
+        if (name == "airplane") {
+            kind = HeuristicKind::Airplane;
+            return true;
+        }
+        if (name == "octile") {
+            kind = HeuristicKind::Octile;
+            return true;
+        }
+        if (name == "landmarks") {
+            kind = HeuristicKind::Landmarks;
+            return true;
+        }
+        return false;
+    }
+
+    // 4er-Nachbarschaft: Richtung d wie bei Map::freeNeighbours (oben, unten, links,
+    // rechts), jeder Schritt kostet 1
+    struct FourConnected {
+        static constexpr int count = 4;
+        static constexpr int straightCost = 1;
+        static constexpr int diagonalCost = 2;                  // ueber zwei gerade Schritte
+        static constexpr int dx[count] = { 0, 0, -1, 1 };
+        static constexpr int dy[count] = { -1, 1, 0, 0 };
+        static constexpr int cost[count] = { 1, 1, 1, 1 };
+        static constexpr int reverse[count] = { 1, 0, 3, 2 };   // Gegenrichtung
+
+        static unsigned moves(const Map& map, int x, int y) { return map.freeNeighbours(x, y); }
+    };
+
+    // 8er-Nachbarschaft ohne Eckenschneiden (Map::freeNeighbours8). Die Kosten bleiben
+    // ganzzahlig: gerade 70, diagonal 99 (99 / 70 = 1,4143 fuer Wurzel 2).
+    struct EightConnected {
+        static constexpr int count = 8;
+        static constexpr int straightCost = 70;
+        static constexpr int diagonalCost = 99;
+        static constexpr int dx[count] = { 0, 0, -1, 1, -1, 1, -1, 1 };
+        static constexpr int dy[count] = { -1, 1, 0, 0, -1, -1, 1, 1 };
+        static constexpr int cost[count] = { 70, 70, 70, 70, 99, 99, 99, 99 };
+        static constexpr int reverse[count] = { 1, 0, 3, 2, 7, 6, 5, 4 };
+
+        static unsigned moves(const Map& map, int x, int y) { return map.freeNeighbours8(x, y); }
+    };
+
+    // Nachbarschaft zu 4 oder 8 (Kommandozeile --connectivity); andere Werte ergeben 4
+    inline int normalizeConnectivity(int connectivity) {
+        return connectivity == 8 ? 8 : 4;
+    }
+
+    // Kosten eines geraden Schritts, d. h. die Einheit von path_length und algorithm_map
+    // (JSON: cost_scale). Die Breitensuchen zaehlen Schritte und haben immer 1.
+    inline int costScale(int connectivity) {
+        return connectivity == 8 ? EightConnected::straightCost : FourConnected::straightCost;
+    }
+
+    // Heuristiken als Funktionsobjekte mit festem Ziel, in Kosteneinheiten der Nachbarschaft.
+    // Manhattan ist nur fuer die 4er-Nachbarschaft zulaessig (ueberschaetzt Diagonalen).
+    template <typename Neighbourhood>
+    struct ManhattanHeuristic {
+        int goalX, goalY;
+
+        int operator()(int x, int y) const {
+            return Neighbourhood::straightCost * (std::abs(x - goalX) + std::abs(y - goalY));
+        }
+    };
+
+    // Luftlinie (euklidisch, abgerundet); in beiden Nachbarschaften zulaessig und konsistent
+    template <typename Neighbourhood>
+    struct AirplaneHeuristic {
+        int goalX, goalY;
+
+        int operator()(int x, int y) const {
+            int dx = x - goalX, dy = y - goalY;
+            return static_cast<int>(Neighbourhood::straightCost * std::sqrt(static_cast<double>(dx * dx + dy * dy)));
+        }
+    };
+
+    // Oktil-Abstand: so viele Diagonalen wie moeglich, der Rest gerade. Exakte Kosten ohne
+    // Hindernisse und damit die schaerfste zulaessige Heuristik der Nachbarschaft; bei
+    // 4er-Nachbarschaft (Diagonale = 2 gerade Schritte) gleich Manhattan.
+    template <typename Neighbourhood>
+    struct OctileHeuristic {
+        int goalX, goalY;
+
+        int operator()(int x, int y) const {
+            int dx = std::abs(x - goalX), dy = std::abs(y - goalY);
+            int diagonal = dx < dy ? dx : dy;
+            return Neighbourhood::straightCost * (dx + dy - 2 * diagonal) + Neighbourhood::diagonalCost * diagonal;
+        }
+    };
+
+    // Keine Schaetzung: A* wird zu Dijkstra
+    template <typename Neighbourhood>
+    struct ZeroHeuristic {
+        int goalX, goalY;
+
+        int operator()(int, int) const { return 0; }
+    };
+
+    // Kostenmodelle: Kosten des Zuges in Richtung d auf das Feld next (Map::index) und
+    // Skalierung der Heuristik, damit sie zulaessig und konsistent bleibt.
+    // Einheitliche Kosten: nur die Schrittkosten der Nachbarschaft
+    template <typename Neighbourhood>
+    struct UniformCost {
+        int step(size_t, int d) const { return Neighbourhood::cost[d]; }
+        int scaleHeuristic(int h) const { return h; }
+    };
+
+    // Gelaendekosten (CostMap): Schrittkosten mal Kosten des betretenen Feldes. Jeder Zug
+    // kostet mindestens minCost-mal so viel wie ohne Gelaende, die mit minCost skalierte
+    // Heuristik bleibt also konsistent.
+    template <typename Neighbourhood>
+    struct TerrainCost {
+        const uint8_t* costs;       // gleiche Anordnung wie die Map
+        int minCost;
+
+        int step(size_t next, int d) const { return Neighbourhood::cost[d] * costs[next]; }
+        int scaleHeuristic(int h) const { return h * minCost; }
+    };
+
+}
+
+#endif
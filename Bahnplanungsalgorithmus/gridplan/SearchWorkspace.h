@@ -0,0 +1,104 @@
+#ifndef GRIDPLAN_SEARCHWORKSPACE_H
+#define GRIDPLAN_SEARCHWORKSPACE_H
+
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../Grid.h"
+#include "../Map.h"
+#include "OpenList.h"
+
+namespace gridplan {
+
+    // Arbeitsspeicher der Suchen (Wavefront, A*, Dijkstra) fuer viele Anfragen auf derselben
+    // Karte, z. B. im Stapelbetrieb (Batch.h). Matrizen und offene Listen werden beim ersten
+    // Gebrauch angelegt und danach behalten. Jede Suche beginnt mit begin(), das nur die in
+    // touched vermerkten Felder der vorigen Suche zuruecksetzt: eine kurze Anfrage auf einer
+    // grossen Karte kostet so nicht mehr das Anlegen und Fuellen ganzer Matrizen.
+    class SearchWorkspace {
+    public:
+        explicit SearchWorkspace(const Map& map)
+            : width(map.getWidth()), height(map.getHeight()), layout(map.getLayout()) {}
+
+        // Vor jeder Suche: Felder der vorigen Suche zuruecksetzen, touched leeren
+        void begin() {
+            if (distanceGrid.size() > 0) {
+                for (uint32_t node : touched) {
+                    distanceGrid.at(node) = -1;
+                }
+            }
+            if (gScoreGrid.size() > 0) {
+                for (uint32_t node : touched) {
+                    gScoreGrid.at(node) = INT_MAX;
+                }
+            }
+            if (heap) {
+                heap->clear(touched);
+            }
+            if (bucketQueue) {
+                bucketQueue->clear(touched);
+            }
+            if (radixHeap) {
+                radixHeap->clear(touched);
+            }
+            touched.clear();
+        }
+
+        // Schritte vom Start (Wavefront), -1 = nicht erreicht
+        Grid<int>& distance() {
+            if (distanceGrid.size() == 0) {
+                distanceGrid = Grid<int>(width, height, -1, layout);
+            }
+            return distanceGrid;
+        }
+
+        // Kosten vom Start (A*), INT_MAX = nicht erreicht
+        Grid<int>& gScore() {
+            if (gScoreGrid.size() == 0) {
+                gScoreGrid = Grid<int>(width, height, INT_MAX, layout);
+            }
+            return gScoreGrid;
+        }
+
+        // Offene Liste der Art OpenList (DaryHeap<4>, BucketQueue oder RadixHeap)
+        template <typename OpenList>
+        OpenList& openList() {
+            std::unique_ptr<OpenList>& list = slot<OpenList>();
+            if (!list) {
+                list = std::make_unique<OpenList>(Grid<int>::storageSize(width, height, layout));
+            }
+            return *list;
+        }
+
+        // Von der laufenden Suche beruehrte Felder (Map::index); die Suche traegt jedes Feld
+        // ein, dessen Eintrag in distance, gScore oder der offenen Liste sie veraendert
+        std::vector<uint32_t> touched;
+
+    private:
+        template <typename OpenList>
+        std::unique_ptr<OpenList>& slot() {
+            if constexpr (std::is_same_v<OpenList, BucketQueue>) {
+                return bucketQueue;
+            }
+            else if constexpr (std::is_same_v<OpenList, RadixHeap>) {
+                return radixHeap;
+            }
+            else {
+                return heap;
+            }
+        }
+
+        int width, height;
+        GridLayout layout;
+        Grid<int> distanceGrid;
+        Grid<int> gScoreGrid;
+        std::unique_ptr<DaryHeap<4>> heap;
+        std::unique_ptr<BucketQueue> bucketQueue;
+        std::unique_ptr<RadixHeap> radixHeap;
+    };
+
+}
+
+#endif
@@ -0,0 +1,82 @@
+#include "Timing.h"
+#include <algorithm>
+#include <cmath>
+
+namespace gridplan {
+
+    // Zweiseitiges 97,5%-Quantil der t-Verteilung fuer 1..30 Freiheitsgrade, danach ~1,96
+    static double studentT975(int degreesOfFreedom) {
+        static const double table[30] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        if (degreesOfFreedom < 1) {
+            return 0;
+        }
+        return degreesOfFreedom <= 30 ? table[degreesOfFreedom - 1] : 1.96;
+    }
+
+    // Quantil mit linearer Interpolation auf sortierten Werten
+    static double quantile(const std::vector<double>& sorted, double q) {
+        double position = q * (sorted.size() - 1);
+        size_t lower = static_cast<size_t>(position);
+        size_t upper = std::min(lower + 1, sorted.size() - 1);
+        return sorted[lower] + (position - lower) * (sorted[upper] - sorted[lower]);
+    }
+
+    TimingStats summarizeTimings(std::vector<double> samples) {
+        TimingStats stats;
+        stats.runs = static_cast<int>(samples.size());
+        if (samples.empty()) {
+            return stats;
+        }
+        std::sort(samples.begin(), samples.end());
+        stats.min = samples.front();
+        stats.median = quantile(samples, 0.5);
+        stats.p95 = quantile(samples, 0.95);
+
+        double sum = 0;
+        for (double s : samples) {
+            sum += s;
+        }
+        stats.mean = sum / samples.size();
+
+        if (samples.size() > 1) {
+            double squares = 0;
+            for (double s : samples) {
+                squares += (s - stats.mean) * (s - stats.mean);
+            }
+            stats.stddev = std::sqrt(squares / (samples.size() - 1));
+            stats.ci95 = studentT975(stats.runs - 1) * stats.stddev / std::sqrt(static_cast<double>(samples.size()));
+        }
+        return stats;
+    }
+
+    TimingStats measureRepeated(const RepeatOptions& options, const std::function<void()>& run) {
+        int minimum = std::max(options.repeat, 1);
+        int maximum = std::max(options.maxRepeat > 0 ? options.maxRepeat : 10 * minimum, minimum);
+
+        for (int i = 0; i < options.warmup; i++) {
+            run();
+        }
+
+        std::vector<double> samples;
+        samples.reserve(minimum);
+        TimingStats stats;
+        while (true) {
+            samples.push_back(timeMilliseconds(run));
+            if (static_cast<int>(samples.size()) < minimum) {
+                continue;
+            }
+            stats = summarizeTimings(samples);
+            stats.converged = samples.size() > 1 && stats.ci95 <= options.precision * stats.mean;
+            if (stats.converged || static_cast<int>(samples.size()) >= maximum) {
+                break;
+            }
+        }
+        stats.warmup = options.warmup;
+        return stats;
+    }
+
+}
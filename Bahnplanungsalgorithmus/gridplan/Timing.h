@@ -0,0 +1,52 @@
+#ifndef GRIDPLAN_TIMING_H
+#define GRIDPLAN_TIMING_H
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace gridplan {
+
+    // Wiederholte Zeitmessung (--repeat N --warmup K --precision P --max-repeat M)
+    struct RepeatOptions {
+        int repeat = 1;             // Mindestanzahl gemessener Laeufe; 1 = Einzelmessung wie bisher
+        int warmup = 0;             // ungemessene Laeufe vorab (Caches, Seitenfehler)
+        double precision = 0.05;    // Ziel: halbe Breite des 95%-Konfidenzintervalls <= precision * Mittelwert
+        int maxRepeat = 0;          // Obergrenze der Laeufe, 0 = 10 * repeat
+
+        bool enabled() const { return repeat > 1 || warmup > 0; }
+    };
+
+    // Verteilung der gemessenen Laufzeiten in Millisekunden
+    struct TimingStats {
+        int runs = 0;               // 0 = keine Wiederholungsmessung
+        int warmup = 0;
+        double min = 0;
+        double median = 0;
+        double mean = 0;
+        double p95 = 0;
+        double stddev = 0;          // Stichproben-Standardabweichung
+        double ci95 = 0;            // halbe Breite des 95%-Konfidenzintervalls des Mittelwerts
+        bool converged = false;     // true, wenn precision vor maxRepeat erreicht wurde
+    };
+
+    // Kennzahlen einer Messreihe (Millisekunden)
+    TimingStats summarizeTimings(std::vector<double> samples);
+
+    // Fuehrt run zuerst warmup-mal ungemessen aus, danach mindestens repeat-mal gemessen
+    // und so lange weiter, bis das Konfidenzintervall eng genug ist oder maxRepeat erreicht ist.
+    // run muss bei jedem Aufruf einen frischen Arbeitsspeicher anlegen.
+    TimingStats measureRepeated(const RepeatOptions& options, const std::function<void()>& run);
+
+    // Zeit eines einzelnen Aufrufs in Millisekunden
+    template <typename F>
+    double timeMilliseconds(F&& run) {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        run();
+        auto endTime = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count() / 1000000.0;
+    }
+
+}
+
+#endif
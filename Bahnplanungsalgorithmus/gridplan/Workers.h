@@ -0,0 +1,31 @@
+#ifndef GRIDPLAN_WORKERS_H
+#define GRIDPLAN_WORKERS_H
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Aufteilung einer Arbeit auf mehrere Threads (parallele Breitensuche, Distanztransformation)
+namespace gridplan {
+
+    // worker(t) fuer t = 0 .. threads - 1, Thread 0 ist der aufrufende
+    template <typename Worker>
+    void runWorkers(int threads, const Worker& worker) {
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back([&worker, t]() { worker(t); });
+        }
+        worker(0);
+        for (std::thread& th : pool) {
+            th.join();
+        }
+    }
+
+    // Ausschnitt [sliceBegin(t), sliceBegin(t + 1)) von total fuer Thread t
+    inline size_t sliceBegin(size_t total, int t, int threads) {
+        return total * static_cast<size_t>(t) / static_cast<size_t>(threads);
+    }
+
+}
+
+#endif
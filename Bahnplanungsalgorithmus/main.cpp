@@ -15,7 +15,7 @@ int main() {
     vector<Algorithm> algorithms;
     vector<ParseJson> parsedResults;
     // Karte erstellen
-    cout << "Mchten Sie eine vorhandene Karte verwenden? (ja/nein): ";
+    cout << "Möchten Sie eine vorhandene Karte verwenden? (ja/nein): ";
     getline(cin, input);
     Map map(1, 1);
     if (input == "ja" || input == "Ja") {
@@ -23,7 +23,7 @@ int main() {
         cout << "Bitte Dateiname angeben:" << std::endl;
         cin >> filename;
         try {
-            map= map.loadFromCSV(filename);
+            map= Map::loadFromFile(filename);
         }
         catch (const std::exception& e) {
             std::cerr << "Fehler beim Laden der Karte: " << e.what() << std::endl;
@@ -45,7 +45,7 @@ int main() {
 
     filename = "result";
     for (const auto& alg : algorithms) {
-        filename += "_" + alg.getName() + "_" + alg.getLanguage() + ".json";  // bergabe im Format "Name:Sprache"
+        filename += "_" + alg.getName() + "_" + alg.getLanguage() + ".json";  // Übergabe im Format "Name:Sprache"
         ifstream file(filename);
         if (file.is_open()) {
             parsedResults.push_back(ParseJson(filename, alg.getName(), alg.getLanguage()));
@@ -2,6 +2,27 @@ import subprocess
 import sys
 import os
 
+# Gemeinsame C++-Bibliothek gridplan (Loader, Planer, JSON-Ausgabe, Speichermessung).
+# Die Programme in Cpp_Algorithms sind nur noch duenne Huellen und werden dagegen gelinkt.
+GRIDPLAN_SOURCES = ["CostMap.cpp", "Map.cpp", "MappedFile.cpp", "ParseCsv.cpp", "gridplan\\Batch.cpp",
+                    "gridplan\\Bidirectional.cpp", "gridplan\\DistanceTransform.cpp", "gridplan\\DStarLite.cpp",
+                    "gridplan\\DynamicBrushfire.cpp", "gridplan\\HpaStar.cpp", "gridplan\\JumpPointSearch.cpp",
+                    "gridplan\\Landmarks.cpp", "gridplan\\MemoryProbe.cpp", "gridplan\\Options.cpp", "gridplan\\ParallelBfs.cpp",
+                    "gridplan\\Planners.cpp", "gridplan\\ResultWriter.cpp", "gridplan\\Timing.cpp"]
+GRIDPLAN_LIBRARY = "gridplan\\libgridplan.a"
+# Ersetzter operator new fuer memory_allocated; nur in den Planer-Programmen, nicht in der Bibliothek
+ALLOCATION_COUNTER = "Cpp_Algorithms\\AllocationCounter.cpp"
+
+def build_gridplan():
+    objects = []
+    for source in GRIDPLAN_SOURCES:
+        obj = os.path.splitext(source)[0] + ".o"
+        compile_command = f"g++ -O2 -std=c++17 -c {source} -o {obj} -ICpp_Algorithms\\include"
+        print(f"Kompiliere gridplan: {compile_command}")
+        subprocess.run(compile_command, shell=True, check=True)
+        objects.append(obj)
+    subprocess.run(f"ar rcs {GRIDPLAN_LIBRARY} {' '.join(objects)}", shell=True, check=True)
+
 def run_program(command, description):
     try:
         print(f"Starte {description}...")
@@ -33,6 +54,7 @@ def main():
         return
 
     algorithms = sys.argv[1:]  # Alle Argumente ab dem zweiten Index (Index 0 ist der Skriptname)
+    gridplan_built = False
 
     # Gib alle uebergebenen Algorithmen aus
     for alg in algorithms:
@@ -48,6 +70,12 @@ def main():
             script_name = "AStarAP"
         elif name == "AStarMH":
             script_name = "AStarMH"
+        elif name == "HPAStar":
+            script_name = "HPA_Star"
+            # HPA* gibt es nur als C++-Programm
+            if language != "Cpp":
+                print(f"{name} ist nur in C++ verfuegbar.")
+                continue
         else:
             print(f"Unbekannter Algorithmus: {name}")
             continue
@@ -133,7 +161,15 @@ def main():
                 print(f"Fehler: Die Datei {folder}/{script_name}.cpp wurde nicht gefunden.")
                 continue
             
-            compile_command = f"g++ -o {folder}\\{script_name}.exe {folder}\\{script_name}.cpp -I{folder}\\include"
+            # Die Bibliothek wird nur beim ersten C++-Algorithmus gebaut
+            if not gridplan_built:
+                try:
+                    build_gridplan()
+                    gridplan_built = True
+                except subprocess.CalledProcessError as e:
+                    print(f"Fehler beim Kompilieren von gridplan: {e}")
+                    return
+            compile_command = f"g++ -O2 -std=c++17 -o {folder}\\{script_name}.exe {folder}\\{script_name}.cpp {ALLOCATION_COUNTER} {GRIDPLAN_LIBRARY} -pthread"
             exe_path = os.path.abspath(f"{folder}\\{name}.exe")
             # Versuche, das C++-Programm zu kompilieren
             try: